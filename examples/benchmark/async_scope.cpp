@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how fast threads can run nested operations in one shared async_scope, once with
+// the single active count and once with a sharded one.
+//
+// usage: example.benchmark.async_scope [max threads] [operations per thread]
+#include <exec/async_scope.hpp>
+#include <stdexec/execution.hpp>
+
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+struct sink_receiver {
+  using receiver_concept = ex::receiver_t;
+
+  void set_value() noexcept {
+  }
+
+  void set_stopped() noexcept {
+  }
+};
+
+auto run(std::size_t nthreads, std::size_t ops_per_thread, std::optional<std::size_t> shards)
+  -> double {
+  std::optional<exec::async_scope> scope;
+  if (shards) {
+    scope.emplace(*shards);
+  } else {
+    scope.emplace();
+  }
+  std::barrier<> barrier(static_cast<std::ptrdiff_t>(nthreads + 1));
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < nthreads; ++i) {
+    threads.emplace_back([&] {
+      barrier.arrive_and_wait();
+      for (std::size_t n = 0; n < ops_per_thread; ++n) {
+        auto op = ex::connect(scope->nest(ex::just()), sink_receiver{});
+        ex::start(op);
+      }
+    });
+  }
+  barrier.arrive_and_wait();
+  auto start = std::chrono::steady_clock::now();
+  for (auto& thread: threads) {
+    thread.join();
+  }
+  ex::sync_wait(scope->on_empty());
+  auto end = std::chrono::steady_clock::now();
+  auto seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(nthreads * ops_per_thread) / seconds;
+}
+
+auto main(int argc, char** argv) -> int {
+  std::size_t max_threads = std::thread::hardware_concurrency();
+  std::size_t ops_per_thread = 1'000'000;
+  if (argc > 1) {
+    max_threads = static_cast<std::size_t>(std::atoi(argv[1]));
+  }
+  if (argc > 2) {
+    ops_per_thread = static_cast<std::size_t>(std::atoi(argv[2]));
+  }
+  std::cout << "threads | single count (ops/s) | sharded count (ops/s)\n";
+  for (std::size_t nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    double single = run(nthreads, ops_per_thread, std::nullopt);
+    double sharded = run(nthreads, ops_per_thread, nthreads);
+    std::cout << std::setw(7) << nthreads << " | " << std::setw(20) << std::setprecision(3)
+              << single << " | " << std::setw(21) << sharded << "\n";
+  }
+}
@@ -19,14 +19,20 @@
 #include "../../stdexec/__detail/__config.hpp"
 #include "../../stdexec/__detail/__spin_loop_pause.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+
 /** 
  * This is an implementation of the BWOS queue as described in
  * BWoS: Formally Verified Block-based Work Stealing for Parallel Processing (Wang et al. 2023)
@@ -35,6 +41,21 @@
 namespace exec::bwos {
   inline constexpr std::size_t hardware_destructive_interference_size = 64;
   inline constexpr std::size_t hardware_constructive_interference_size = 64;
+  inline constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+  // How a `lifo_queue` lays out the slots of its blocks. The slots of all blocks are taken from
+  // a single allocation.
+  struct lifo_queue_layout {
+    // Start the slots of every block on a cache line of their own. Otherwise the owner that
+    // fills one block and the thieves that drain the previous one may share a cache line.
+    bool padBlocks{true};
+    // Align the slots to huge pages and advise the kernel to back them with transparent huge
+    // pages. The slots are rounded up to whole huge pages and allocated through the allocator
+    // of the queue with one more huge page of slack to align them. So every queue costs at
+    // least one huge page (2 MiB) of memory and twice that in address space. The slack is
+    // never touched.
+    bool hugePages{false};
+  };
 
   enum class lifo_queue_error_code {
     success,
@@ -61,7 +82,14 @@ namespace exec::bwos {
     explicit lifo_queue(
       std::size_t num_blocks,
       std::size_t block_size,
-      Allocator allocator = Allocator());
+      Allocator allocator = Allocator(),
+      lifo_queue_layout layout = {});
+
+    //! Takes over the blocks of `other`, which must not be in use by the owner or by thieves.
+    //! Afterwards `other` has no blocks and may only be destroyed.
+    lifo_queue(lifo_queue &&other) noexcept;
+
+    ~lifo_queue();
 
     auto pop_back() noexcept -> Tp;
 
@@ -87,13 +115,9 @@ namespace exec::bwos {
     using allocator_of_t = std::allocator_traits<Allocator>::template rebind_alloc<Sp>;
 
     struct block_type {
-      explicit block_type(std::size_t block_size, Allocator allocator = Allocator());
-
-      block_type(const block_type &);
-      auto operator=(const block_type &) -> block_type &;
+      explicit block_type(Tp *slots, std::size_t block_size) noexcept;
 
       block_type(block_type &&) noexcept;
-      auto operator=(block_type &&) noexcept -> block_type &;
 
       auto put(Tp value) noexcept -> lifo_queue_error_code;
 
@@ -125,7 +149,8 @@ namespace exec::bwos {
       alignas(hardware_destructive_interference_size) std::atomic<std::uint64_t> tail_{};
       alignas(hardware_destructive_interference_size) std::atomic<std::uint64_t> steal_head_{};
       alignas(hardware_destructive_interference_size) std::atomic<std::uint64_t> steal_tail_{};
-      std::vector<Tp, Allocator> ring_buffer_;
+      Tp *ring_buffer_;
+      std::size_t block_size_;
     };
 
     auto advance_get_index() noexcept -> bool;
@@ -136,8 +161,29 @@ namespace exec::bwos {
     alignas(hardware_destructive_interference_size) std::atomic<std::size_t> thief_block_{0};
     std::vector<block_type, allocator_of_t<block_type>> blocks_{};
     std::size_t mask_{};
+    Allocator allocator_;
+    // The allocation that holds the slots of all blocks, and the aligned slots within it.
+    Tp *storage_{nullptr};
+    std::size_t storage_size_{0};
+    Tp *slots_{nullptr};
+    std::size_t num_slots_{0};
   };
 
+  // The number of slots per block such that every block starts on a new cache line.
+  template <class Tp>
+  constexpr auto padded_block_size(std::size_t block_size) noexcept -> std::size_t {
+    constexpr std::size_t slots_per_line =
+      hardware_destructive_interference_size
+      / std::gcd(hardware_destructive_interference_size, sizeof(Tp));
+    return (block_size + slots_per_line - 1) / slots_per_line * slots_per_line;
+  }
+
+  inline void advise_huge_pages([[maybe_unused]] void *ptr, [[maybe_unused]] std::size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    ::madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation of lifo_queue member methods
 
@@ -145,15 +191,63 @@ namespace exec::bwos {
   lifo_queue<Tp, Allocator>::lifo_queue(
     std::size_t num_blocks,
     std::size_t block_size,
-    Allocator allocator)
-    : blocks_(
-        std::max(static_cast<size_t>(2), std::bit_ceil(num_blocks)),
-        block_type(block_size, allocator),
-        allocator_of_t<block_type>(allocator))
-    , mask_(blocks_.size() - 1) {
+    Allocator allocator,
+    lifo_queue_layout layout)
+    : blocks_(allocator_of_t<block_type>(allocator))
+    , allocator_(allocator) {
+    num_blocks = std::max(static_cast<size_t>(2), std::bit_ceil(num_blocks));
+    const std::size_t stride = layout.padBlocks ? padded_block_size<Tp>(block_size) : block_size;
+    const std::size_t alignment =
+      layout.hugePages ? huge_page_size : hardware_destructive_interference_size;
+    num_slots_ = num_blocks * stride;
+    std::size_t size = num_slots_ * sizeof(Tp);
+    if (layout.hugePages) {
+      size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+    blocks_.reserve(num_blocks);
+
+    // Allocate enough slack to align the slots.
+    storage_size_ = (size + alignment + sizeof(Tp) - 1) / sizeof(Tp);
+    storage_ = std::allocator_traits<Allocator>::allocate(allocator_, storage_size_);
+    void *aligned = storage_;
+    std::size_t space = storage_size_ * sizeof(Tp);
+    slots_ = static_cast<Tp *>(std::align(alignment, size, aligned, space));
+    STDEXEC_ASSERT(slots_ != nullptr);
+    std::uninitialized_value_construct_n(slots_, num_slots_);
+    if (layout.hugePages) {
+      advise_huge_pages(slots_, size);
+    }
+
+    for (std::size_t i = 0; i < num_blocks; ++i) {
+      blocks_.emplace_back(slots_ + i * stride, block_size);
+    }
+    mask_ = blocks_.size() - 1;
     blocks_[owner_block_.load()].reclaim();
   }
 
+  template <class Tp, class Allocator>
+  lifo_queue<Tp, Allocator>::lifo_queue(lifo_queue &&other) noexcept
+    : blocks_(std::move(other.blocks_))
+    , mask_(other.mask_)
+    , allocator_(other.allocator_)
+    , storage_(std::exchange(other.storage_, nullptr))
+    , storage_size_(std::exchange(other.storage_size_, 0))
+    , slots_(std::exchange(other.slots_, nullptr))
+    , num_slots_(std::exchange(other.num_slots_, 0)) {
+    owner_block_.store(
+      other.owner_block_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    thief_block_.store(
+      other.thief_block_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  template <class Tp, class Allocator>
+  lifo_queue<Tp, Allocator>::~lifo_queue() {
+    if (storage_ != nullptr) {
+      std::destroy_n(slots_, num_slots_);
+      std::allocator_traits<Allocator>::deallocate(allocator_, storage_, storage_size_);
+    }
+  }
+
   template <class Tp, class Allocator>
   auto lifo_queue<Tp, Allocator>::pop_back() noexcept -> Tp {
     do {
@@ -301,52 +395,23 @@ namespace exec::bwos {
   // Implementation of lifo_queue::block_type member methods
 
   template <class Tp, class Allocator>
-  lifo_queue<Tp, Allocator>::block_type::block_type(std::size_t block_size, Allocator allocator)
+  lifo_queue<Tp, Allocator>::block_type::block_type(Tp *slots, std::size_t block_size) noexcept
     : head_{0}
     , tail_{0}
     , steal_head_{0}
     , steal_tail_{block_size}
-    , ring_buffer_(block_size, allocator) {
-  }
-
-  template <class Tp, class Allocator>
-  lifo_queue<Tp, Allocator>::block_type::block_type(const block_type &other)
-    : ring_buffer_(other.ring_buffer_) {
-    head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_tail_.store(other.steal_tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_head_.store(other.steal_head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-  }
-
-  template <class Tp, class Allocator>
-  auto lifo_queue<Tp, Allocator>::block_type::operator=(const block_type &other)
-    -> lifo_queue<Tp, Allocator>::block_type & {
-    head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_tail_.store(other.steal_tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_head_.store(other.steal_head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    ring_buffer_ = other.ring_buffer_;
-    return *this;
-  }
-
-  template <class Tp, class Allocator>
-  lifo_queue<Tp, Allocator>::block_type::block_type(block_type &&other) noexcept {
-    head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_tail_.store(other.steal_tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    steal_head_.store(other.steal_head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    ring_buffer_ = std::exchange(std::move(other.ring_buffer_), {});
+    , ring_buffer_(slots)
+    , block_size_(block_size) {
   }
 
   template <class Tp, class Allocator>
-  auto lifo_queue<Tp, Allocator>::block_type::operator=(block_type &&other) noexcept
-    -> lifo_queue<Tp, Allocator>::block_type & {
+  lifo_queue<Tp, Allocator>::block_type::block_type(block_type &&other) noexcept
+    : ring_buffer_(std::exchange(other.ring_buffer_, nullptr))
+    , block_size_(other.block_size_) {
     head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
     tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
     steal_tail_.store(other.steal_tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
     steal_head_.store(other.steal_head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    ring_buffer_ = std::exchange(std::move(other.ring_buffer_), {});
-    return *this;
   }
 
   template <class Tp, class Allocator>
@@ -454,7 +519,7 @@ namespace exec::bwos {
 
   template <class Tp, class Allocator>
   auto lifo_queue<Tp, Allocator>::block_type::block_size() const noexcept -> std::size_t {
-    return ring_buffer_.size();
+    return block_size_;
   }
 
   template <class Tp, class Allocator>
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+namespace exec {
+  // How the threads of a `static_thread_pool` or an `io_uring_pool` are pinned to CPUs.
+  enum class cpu_placement : std::uint8_t {
+    // Workers are not pinned and may migrate between the CPUs of their NUMA node.
+    none,
+    // Consecutive workers share SMT siblings, cores and L3 caches before the next ones are used.
+    compact,
+    // Consecutive workers are spread over packages and L3 caches, and use every physical core
+    // before a second SMT sibling.
+    scatter
+  };
+
+  struct affinity_params {
+    cpu_placement placement{cpu_placement::none};
+    // Use at most one SMT sibling of every physical core.
+    bool onePerCore{false};
+    // Leave out the CPUs listed in `isolated`, e.g. via the `isolcpus` kernel parameter.
+    bool excludeIsolated{true};
+  };
+
+  // A logical CPU as described by `/sys/devices/system/cpu`.
+  // Topology information that is not available is -1.
+  struct cpu_info {
+    int cpu{-1};
+    int core{-1};
+    int package{-1};
+    int l3{-1};
+    int node{-1};
+    bool isolated{false};
+  };
+
+  namespace _topology {
+    // Returns -1 unless `text` is a non-negative decimal number.
+    inline auto parse_int(std::string_view text) noexcept -> int {
+      int value = -1;
+      const char* last = text.data() + text.size();
+      auto [ptr, ec] = std::from_chars(text.data(), last, value);
+      return ec == std::errc{} && ptr == last && value >= 0 ? value : -1;
+    }
+
+    // Parses a cpu list such as "0-3,8,10-11". Malformed ranges are skipped.
+    inline auto parse_cpu_list(std::string_view list) -> std::vector<int> {
+      std::vector<int> cpus;
+      while (!list.empty()) {
+        const std::size_t comma = list.find(',');
+        const std::string_view range = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+        const std::size_t dash = range.find('-');
+        const int first = parse_int(range.substr(0, dash));
+        const int last = dash == std::string_view::npos ? first : parse_int(range.substr(dash + 1));
+        for (int cpu = first; first >= 0 && cpu <= last; ++cpu) {
+          cpus.push_back(cpu);
+        }
+      }
+      return cpus;
+    }
+
+    inline auto read_line(const std::filesystem::path& path) -> std::string {
+      std::ifstream file{path};
+      std::string line;
+      std::getline(file, line);
+      return line;
+    }
+
+    inline auto read_int(const std::filesystem::path& path) -> int {
+      return parse_int(read_line(path));
+    }
+
+    inline auto read_l3(const std::filesystem::path& cpu_dir) -> int {
+      for (int index = 0;; ++index) {
+        const std::filesystem::path cache = cpu_dir / "cache" / ("index" + std::to_string(index));
+        std::error_code ec;
+        if (!std::filesystem::exists(cache, ec)) {
+          return -1;
+        }
+        if (read_int(cache / "level") != 3) {
+          continue;
+        }
+        if (const int id = read_int(cache / "id"); id >= 0) {
+          return id;
+        }
+        // Older kernels have no cache ids, the first CPU of the cache identifies it as well.
+        const std::vector<int> shared = parse_cpu_list(read_line(cache / "shared_cpu_list"));
+        return shared.empty() ? -1 : shared.front();
+      }
+    }
+
+    inline auto read_node(const std::filesystem::path& cpu_dir) -> int {
+      std::error_code ec;
+      for (const auto& entry: std::filesystem::directory_iterator(cpu_dir, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.starts_with("node")) {
+          if (const int node = parse_int(std::string_view(name).substr(4)); node >= 0) {
+            return node;
+          }
+        }
+      }
+      return -1;
+    }
+  } // namespace _topology
+
+  // The CPUs of the machine and how they share cores, caches and packages.
+  class cpu_topology {
+   public:
+    cpu_topology() = default;
+
+    explicit cpu_topology(std::vector<cpu_info> cpus) noexcept
+      : cpus_(std::move(cpus)) {
+    }
+
+    // Reads the online CPUs from a sysfs directory laid out like `/sys/devices/system/cpu`.
+    // The topology is empty if the directory cannot be read.
+    static auto from_sysfs(const std::filesystem::path& root) -> cpu_topology {
+      std::vector<cpu_info> cpus;
+      const std::vector<int> isolated =
+        _topology::parse_cpu_list(_topology::read_line(root / "isolated"));
+      for (const int cpu: _topology::parse_cpu_list(_topology::read_line(root / "online"))) {
+        const std::filesystem::path dir = root / ("cpu" + std::to_string(cpu));
+        cpus.push_back({
+          .cpu = cpu,
+          .core = _topology::read_int(dir / "topology" / "core_id"),
+          .package = _topology::read_int(dir / "topology" / "physical_package_id"),
+          .l3 = _topology::read_l3(dir),
+          .node = _topology::read_node(dir),
+          .isolated = std::find(isolated.begin(), isolated.end(), cpu) != isolated.end(),
+        });
+      }
+      return cpu_topology{std::move(cpus)};
+    }
+
+    // The topology of the CPUs that the calling thread may run on.
+    static auto current() -> cpu_topology {
+      cpu_topology topology = from_sysfs("/sys/devices/system/cpu");
+#if defined(__linux__)
+      ::cpu_set_t allowed;
+      CPU_ZERO(&allowed);
+      if (::sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        std::erase_if(topology.cpus_, [&](const cpu_info& info) {
+          return info.cpu >= CPU_SETSIZE || !CPU_ISSET(info.cpu, &allowed);
+        });
+      }
+#endif
+      return topology;
+    }
+
+    [[nodiscard]]
+    auto cpus() const noexcept -> std::span<const cpu_info> {
+      return cpus_;
+    }
+
+    // Returns the CPUs to pin consecutive workers to, in order. Worker `i` gets the CPU at
+    // `i % size()`. The result is empty for `cpu_placement::none`.
+    [[nodiscard]]
+    auto place(const affinity_params& params) const -> std::vector<cpu_info> {
+      if (params.placement == cpu_placement::none) {
+        return {};
+      }
+      struct candidate {
+        cpu_info info;
+        // The rank of the CPU among the SMT siblings of its core.
+        int sibling{0};
+        // The rank of the CPU within its L3 cache and of the L3 cache within its package.
+        int rank_in_l3{0};
+        int l3_in_package{0};
+      };
+      std::vector<candidate> candidates;
+      for (const cpu_info& info: cpus_) {
+        if (!(params.excludeIsolated && info.isolated)) {
+          candidates.push_back({.info = info});
+        }
+      }
+
+      auto sort_by = [&](auto key) {
+        // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
+        std::sort(
+          candidates.begin(), candidates.end(), [&](const candidate& a, const candidate& b) {
+            return key(a) < key(b);
+          });
+      };
+
+      sort_by([](const candidate& c) {
+        return std::tuple{c.info.package, c.info.core, c.info.cpu};
+      });
+      for (std::size_t i = 1; i < candidates.size(); ++i) {
+        const cpu_info& prev = candidates[i - 1].info;
+        const cpu_info& info = candidates[i].info;
+        if (info.core >= 0 && info.package == prev.package && info.core == prev.core) {
+          candidates[i].sibling = candidates[i - 1].sibling + 1;
+        }
+      }
+      if (params.onePerCore) {
+        std::erase_if(candidates, [](const candidate& c) { return c.sibling > 0; });
+      }
+
+      if (params.placement == cpu_placement::compact) {
+        sort_by([](const candidate& c) {
+          return std::tuple{c.info.package, c.info.l3, c.info.core, c.sibling, c.info.cpu};
+        });
+      } else {
+        sort_by([](const candidate& c) {
+          return std::tuple{c.info.package, c.info.l3, c.sibling, c.info.core, c.info.cpu};
+        });
+        for (std::size_t i = 1; i < candidates.size(); ++i) {
+          const candidate& prev = candidates[i - 1];
+          if (candidates[i].info.package != prev.info.package) {
+            continue;
+          }
+          if (candidates[i].info.l3 == prev.info.l3) {
+            candidates[i].rank_in_l3 = prev.rank_in_l3 + 1;
+            candidates[i].l3_in_package = prev.l3_in_package;
+          } else {
+            candidates[i].l3_in_package = prev.l3_in_package + 1;
+          }
+        }
+        // Round robin over the packages, then over the L3 caches of each package.
+        sort_by([](const candidate& c) {
+          return std::tuple{c.rank_in_l3, c.l3_in_package, c.info.package, c.info.cpu};
+        });
+      }
+
+      std::vector<cpu_info> result;
+      result.reserve(candidates.size());
+      for (const candidate& c: candidates) {
+        result.push_back(c.info);
+      }
+      return result;
+    }
+
+   private:
+    std::vector<cpu_info> cpus_;
+  };
+
+  // Pins the calling thread to `cpu`. Returns false if that is not supported or fails.
+  inline auto pin_this_thread_to_cpu(int cpu) noexcept -> bool {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return false;
+    }
+    ::cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+  }
+} // namespace exec
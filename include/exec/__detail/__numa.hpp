@@ -441,4 +441,70 @@ namespace exec {
     bool mask_{false};
   };
 } // namespace exec
-#endif
\ No newline at end of file
+#endif
+
+namespace exec {
+  //! An allocator for memory that is mostly accessed from the threads of one NUMA node.
+  //!
+  //! Blocks of at least `page_size` bytes are placed on `node()` by a `numa_allocator`. Smaller
+  //! blocks come from the heap of the calling thread. They are local to `node()` as well if the
+  //! thread is bound to it, as the workers of a `static_thread_pool` are, but do not occupy a
+  //! page each. An allocator with a negative node allocates everything from the heap.
+  template <class T>
+  class node_allocator {
+   public:
+    using value_type = T;
+
+    static constexpr std::size_t page_size = 4096;
+
+    node_allocator() noexcept = default;
+
+    explicit node_allocator(int node) noexcept
+      : node_(node) {
+    }
+
+    template <class U>
+    node_allocator(const node_allocator<U>& other) noexcept
+      : node_(other.node()) {
+    }
+
+    [[nodiscard]]
+    auto node() const noexcept -> int {
+      return node_;
+    }
+
+    auto allocate(std::size_t n) -> T* {
+      if (is_on_node(n)) {
+        // `numa_alloc_onnode` reports a failure with a null pointer.
+        T* p = numa_allocator<T>(node_).allocate(n);
+        if (p == nullptr) {
+          STDEXEC_THROW(std::bad_alloc{});
+        }
+        return p;
+      }
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      if (is_on_node(n)) {
+        numa_allocator<T>(node_).deallocate(p, n);
+      } else {
+        std::allocator<T>{}.deallocate(p, n);
+      }
+    }
+
+    template <class U>
+    friend auto operator==(const node_allocator& lhs, const node_allocator<U>& rhs) noexcept
+      -> bool {
+      return lhs.node() == rhs.node();
+    }
+
+   private:
+    [[nodiscard]]
+    auto is_on_node(std::size_t n) const noexcept -> bool {
+      return node_ >= 0 && n * sizeof(T) >= page_size;
+    }
+
+    int node_{-1};
+  };
+} // namespace exec
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace exec {
+  template <auto Tick, auto Next, auto PPrev>
+  class timer_wheel;
+
+  //! A hierarchical timer wheel over intrusive nodes that expire at an integral tick.
+  //!
+  //! There are `num_levels` levels of 64 slots each. A slot on level `k` spans `64^k` ticks.
+  //! A node is stored on the lowest level whose parent slot it shares with the current tick.
+  //! Slots of higher levels are cascaded to lower levels once the current tick reaches them.
+  //! Nodes that are too far in the future are kept in an overflow list that is re-examined
+  //! whenever the top level wraps around.
+  //!
+  //! Insertion and erasure are O(1). The wheel is not thread-safe.
+  template <
+    class Node,
+    std::uint64_t Node::* Tick,
+    Node* Node::* Next,
+    Node** Node::* PPrev
+  >
+  class timer_wheel<Tick, Next, PPrev> {
+   public:
+    static constexpr std::uint32_t slot_bits = 6;
+    static constexpr std::uint32_t num_slots = 1u << slot_bits;
+    static constexpr std::uint32_t num_levels = 4;
+    static constexpr std::uint64_t never = std::numeric_limits<std::uint64_t>::max();
+
+    explicit timer_wheel(std::uint64_t now = 0) noexcept
+      : now_{now} {
+    }
+
+    timer_wheel(timer_wheel&&) = delete;
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+      return size_ == 0;
+    }
+
+    [[nodiscard]]
+    auto size() const noexcept -> std::size_t {
+      return size_;
+    }
+
+    //! The tick up to which the wheel has expired its nodes.
+    [[nodiscard]]
+    auto now() const noexcept -> std::uint64_t {
+      return now_;
+    }
+
+    //! Inserts `node` unless its tick has already been reached.
+    //! Returns false if the node is expired, the node is not inserted in this case.
+    auto insert(Node* node) noexcept -> bool {
+      const std::uint64_t tick = node->*Tick;
+      if (tick <= now_) {
+        return false;
+      }
+      for (std::uint32_t level = 0; level < num_levels; ++level) {
+        const std::uint32_t parent_shift = slot_bits * (level + 1);
+        if ((tick >> parent_shift) == (now_ >> parent_shift)) {
+          const auto index =
+            static_cast<std::uint32_t>((tick >> (slot_bits * level)) & (num_slots - 1));
+          push_front(slots_[level][index], node);
+          occupied_[level] |= std::uint64_t(1) << index;
+          ++size_;
+          return true;
+        }
+      }
+      push_front(overflow_, node);
+      ++size_;
+      return true;
+    }
+
+    //! Removes `node`, which must have been inserted and not yet expired.
+    void erase(Node* node) noexcept {
+      Node** pprev = node->*PPrev;
+      Node* next = node->*Next;
+      *pprev = next;
+      if (next) {
+        next->*PPrev = pprev;
+      }
+      node->*Next = nullptr;
+      node->*PPrev = nullptr;
+      --size_;
+      // The occupancy bit of the slot is cleared lazily once the slot is reached.
+    }
+
+    //! Returns the next tick at which `advance` has work to do. This is either the tick of the
+    //! earliest node or a tick where nodes are cascaded to a lower level.
+    [[nodiscard]]
+    auto next_tick() const noexcept -> std::uint64_t {
+      if (size_ == 0) {
+        return never;
+      }
+      std::uint64_t result = never;
+      for (std::uint32_t level = 0; level < num_levels; ++level) {
+        if (occupied_[level] == 0) {
+          continue;
+        }
+        const std::uint32_t shift = slot_bits * level;
+        const std::uint32_t parent_shift = shift + slot_bits;
+        const auto index = static_cast<std::uint64_t>(std::countr_zero(occupied_[level]));
+        const std::uint64_t tick = ((now_ >> parent_shift) << parent_shift) + (index << shift);
+        result = tick < result ? tick : result;
+      }
+      if (overflow_) {
+        const std::uint32_t top_shift = slot_bits * num_levels;
+        const std::uint64_t tick = ((now_ >> top_shift) + 1) << top_shift;
+        result = tick < result ? tick : result;
+      }
+      return result;
+    }
+
+    //! Advances the wheel to `tick` and invokes `expire(node)` for every node whose tick has
+    //! been reached. Nodes are removed from the wheel before `expire` is invoked.
+    template <class Expire>
+    void advance(std::uint64_t tick, Expire&& expire) {
+      while (now_ < tick) {
+        const std::uint64_t next = next_tick();
+        if (next > tick) {
+          now_ = tick;
+          return;
+        }
+        now_ = next;
+        if (overflow_ && (now_ & ((std::uint64_t(1) << (slot_bits * num_levels)) - 1)) == 0) {
+          Node* node = std::exchange(overflow_, nullptr);
+          reinsert_all(node, expire);
+        }
+        for (std::uint32_t level = num_levels - 1; level > 0; --level) {
+          const std::uint32_t shift = slot_bits * level;
+          if ((now_ & ((std::uint64_t(1) << shift) - 1)) == 0) {
+            reinsert_all(take_slot(level, (now_ >> shift) & (num_slots - 1)), expire);
+          }
+        }
+        Node* node = take_slot(0, now_ & (num_slots - 1));
+        while (node) {
+          Node* next_node = node->*Next;
+          --size_;
+          node->*Next = nullptr;
+          node->*PPrev = nullptr;
+          expire(node);
+          node = next_node;
+        }
+      }
+    }
+
+   private:
+    static void push_front(Node*& head, Node* node) noexcept {
+      node->*Next = head;
+      node->*PPrev = &head;
+      if (head) {
+        head->*PPrev = &(node->*Next);
+      }
+      head = node;
+    }
+
+    auto take_slot(std::uint32_t level, std::uint64_t index) noexcept -> Node* {
+      occupied_[level] &= ~(std::uint64_t(1) << index);
+      Node* head = std::exchange(slots_[level][index], nullptr);
+      if (head) {
+        head->*PPrev = nullptr;
+      }
+      return head;
+    }
+
+    template <class Expire>
+    void reinsert_all(Node* node, Expire& expire) {
+      while (node) {
+        Node* next_node = node->*Next;
+        --size_;
+        node->*Next = nullptr;
+        node->*PPrev = nullptr;
+        if (!insert(node)) {
+          expire(node);
+        }
+        node = next_node;
+      }
+    }
+
+    std::uint64_t now_;
+    std::size_t size_{0};
+    std::array<std::uint64_t, num_levels> occupied_{};
+    std::array<std::array<Node*, num_slots>, num_levels> slots_{};
+    Node* overflow_{nullptr};
+  };
+} // namespace exec
@@ -17,12 +17,19 @@
 
 #include "../stdexec/execution.hpp"
 #include "../stdexec/stop_token.hpp"
+#include "../stdexec/__detail/__allocator.hpp"
+#include "../stdexec/__detail/__block_cache.hpp"
 #include "../stdexec/__detail/__intrusive_queue.hpp"
 #include "../stdexec/__detail/__optional.hpp"
 #include "env.hpp"
 
 #include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <new>
 
 namespace exec {
   /////////////////////////////////////////////////////////////////////////////
@@ -47,19 +54,148 @@ namespace exec {
     template <class _BaseEnv>
     using __env_t = make_env_t<_BaseEnv, prop<get_stop_token_t, inplace_stop_token>>;
 
+    ////////////////////////////////////////////////////////////////////////////
+    // async_scope recycling allocator
+    template <class _Ty>
+    struct __recycling_allocator {
+      using value_type = _Ty;
+
+      __recycling_allocator() = default;
+
+      template <class _Uy>
+      __recycling_allocator(const __recycling_allocator<_Uy>&) noexcept {
+      }
+
+      auto allocate(std::size_t __n) -> _Ty* {
+        return static_cast<_Ty*>(__block_cache::__allocate(__n * sizeof(_Ty), alignof(_Ty)));
+      }
+
+      void deallocate(_Ty* __p, std::size_t __n) noexcept {
+        __block_cache::__deallocate(__p, __n * sizeof(_Ty), alignof(_Ty));
+      }
+
+      template <class _Uy>
+      auto operator==(const __recycling_allocator<_Uy>&) const noexcept -> bool {
+        return true;
+      }
+    };
+
+    // Monotonic counts of the operations that started and completed on the threads that map
+    // to this shard.
+    struct alignas(64) __count_shard {
+      std::atomic<std::uint64_t> __started_{0};
+      std::atomic<std::uint64_t> __completed_{0};
+    };
+
+    using __waiter_queue = __intrusive_queue<&__task::__next_>;
+
     struct __impl {
+      __impl() = default;
+
+      explicit __impl(std::size_t __num_shards)
+        : __shards_(std::make_unique<__count_shard[]>(std::bit_ceil(__num_shards)))
+        , __shard_mask_(std::bit_ceil(__num_shards) - 1) {
+      }
+
       inplace_stop_source __stop_source_{};
       mutable std::mutex __lock_{};
       mutable std::atomic_ptrdiff_t __active_ = 0;
-      mutable __intrusive_queue<&__task::__next_> __waiters_{};
+      mutable __waiter_queue __waiters_{};
+      // In sharded mode, operations are counted in `__shards_` instead of `__active_`, and
+      // completions only look at the other shards while someone waits for the scope to
+      // become empty.
+      std::unique_ptr<__count_shard[]> __shards_{};
+      std::size_t __shard_mask_{0};
+      mutable std::atomic<bool> __has_waiters_{false};
 
       ~__impl() {
         std::unique_lock __guard{__lock_};
-        STDEXEC_ASSERT(__active_ == 0);
+        STDEXEC_ASSERT(__empty());
         STDEXEC_ASSERT(__waiters_.empty());
       }
+
+      void __add_active() const noexcept {
+        if (__shards_) {
+          __this_thread_shard().__started_.fetch_add(1, std::memory_order_seq_cst);
+        } else {
+          __active_.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+
+      // Returns the waiters to notify if the scope became empty.
+      auto __remove_active() const noexcept -> __waiter_queue {
+        if (!__shards_) {
+          if (__active_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return {};
+          }
+          std::unique_lock __guard{__lock_};
+          return std::move(__waiters_);
+        }
+        __this_thread_shard().__completed_.fetch_add(1, std::memory_order_seq_cst);
+        // Either this load sees the flag, or the waiter that sets it sees the completion above.
+        if (!__has_waiters_.load(std::memory_order_seq_cst)) {
+          return {};
+        }
+        std::unique_lock __guard{__lock_};
+        return __take_waiters_if_empty();
+      }
+
+      // Queues a waiter for the scope to become empty. Returns the waiters to notify, including
+      // `__waiter`, if it already is.
+      auto __add_waiter(__task* __waiter) const noexcept -> __waiter_queue {
+        // must get lock before checking __active, or if the __active is drained before
+        // the waiter is queued but after __active is checked, the waiter will never be notified
+        std::unique_lock __guard{__lock_};
+        __waiters_.push_back(__waiter);
+        __has_waiters_.store(true, std::memory_order_seq_cst);
+        return __take_waiters_if_empty();
+      }
+
+     private:
+      auto __this_thread_shard() const noexcept -> __count_shard& {
+        static std::atomic<std::size_t> __next_thread{0};
+        thread_local const std::size_t __thread_index = __next_thread.fetch_add(
+          1, std::memory_order_relaxed);
+        return __shards_[__thread_index & __shard_mask_];
+      }
+
+      // Must be called with __lock_ held.
+      auto __take_waiters_if_empty() const noexcept -> __waiter_queue {
+        if (__waiters_.empty() || !__empty()) {
+          return {};
+        }
+        __has_waiters_.store(false, std::memory_order_relaxed);
+        return std::move(__waiters_);
+      }
+
+      [[nodiscard]]
+      auto __empty() const noexcept -> bool {
+        if (!__shards_) {
+          return __active_.load(std::memory_order_acquire) == 0;
+        }
+        // All completions are summed before all starts. As both sums only grow and an operation
+        // starts before it completes, they can only be equal if the scope was empty at the
+        // moment between the two passes.
+        std::uint64_t __completed = 0;
+        std::uint64_t __started = 0;
+        for (std::size_t __i = 0; __i <= __shard_mask_; ++__i) {
+          __completed += __shards_[__i].__completed_.load(std::memory_order_seq_cst);
+        }
+        for (std::size_t __i = 0; __i <= __shard_mask_; ++__i) {
+          __started += __shards_[__i].__started_.load(std::memory_order_seq_cst);
+        }
+        return __started == __completed;
+      }
     };
 
+    inline void __notify_waiters(__waiter_queue __waiters) noexcept {
+      while (!__waiters.empty()) {
+        auto* __next = __waiters.pop_front();
+        __next->__notify_waiter(__next);
+        // the scope must be considered deleted
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     // async_scope::when_empty implementation
     template <class _ConstrainedId, class _ReceiverId>
@@ -79,17 +215,8 @@ namespace exec {
         }
 
         void start() & noexcept {
-          // must get lock before checking __active, or if the __active is drained before
-          // the waiter is queued but after __active is checked, the waiter will never be notified
-          std::unique_lock __guard{this->__scope_->__lock_};
-          auto& __active = this->__scope_->__active_;
-          auto& __waiters = this->__scope_->__waiters_;
-          if (__active.load(std::memory_order_acquire) != 0) {
-            __waiters.push_back(this);
-            return;
-          }
-          __guard.unlock();
-          stdexec::start(this->__op_);
+          // do not access this after notifying the waiters
+          __notify_waiters(this->__scope_->__add_waiter(this));
         }
 
        private:
@@ -156,19 +283,10 @@ namespace exec {
         __nest_op_base<_ReceiverId>* __op_;
 
         static void __complete(const __impl* __scope) noexcept {
-          auto& __active = __scope->__active_;
-          if (__active.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-            std::unique_lock __guard{__scope->__lock_};
-            auto __local_waiters = std::move(__scope->__waiters_);
-            __guard.unlock();
-            __scope = nullptr;
-            // do not access __scope
-            while (!__local_waiters.empty()) {
-              auto* __next = __local_waiters.pop_front();
-              __next->__notify_waiter(__next);
-              // __scope must be considered deleted
-            }
-          }
+          auto __local_waiters = __scope->__remove_active();
+          __scope = nullptr;
+          // do not access __scope
+          __notify_waiters(std::move(__local_waiters));
         }
 
         template <class... _As>
@@ -228,8 +346,7 @@ namespace exec {
 
         void start() & noexcept {
           STDEXEC_ASSERT(this->__scope_);
-          auto& __active = this->__scope_->__active_;
-          __active.fetch_add(1, std::memory_order_relaxed);
+          this->__scope_->__add_active();
           stdexec::start(__op_);
         }
       };
@@ -285,6 +402,12 @@ namespace exec {
     template <class _Sender, class _Env>
     struct __future_state;
 
+    template <class _Sender, class _Env>
+    using __future_state_ptr = std::unique_ptr<
+      __future_state<_Sender, _Env>,
+      __allocator_delete<__future_state<_Sender, _Env>>
+    >;
+
     struct __forward_stopped {
       inplace_stop_source* __stop_source_;
 
@@ -355,7 +478,7 @@ namespace exec {
         }
 
         STDEXEC_ATTRIBUTE(no_unique_address) _Receiver __rcvr_;
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        __future_state_ptr<_Sender, _Env> __state_;
         STDEXEC_ATTRIBUTE(no_unique_address)
         stdexec::__optional<__forward_consumer> __forward_consumer_;
 
@@ -378,8 +501,7 @@ namespace exec {
         }
 
         template <class _Receiver2>
-        explicit __t(
-          _Receiver2&& __rcvr, std::unique_ptr<__future_state<_Sender, _Env>> __state)
+        explicit __t(_Receiver2&& __rcvr, __future_state_ptr<_Sender, _Env> __state)
           : __subscription{{},
             [](__subscription* __self) noexcept -> void {
                 static_cast<__t*>(__self)->__complete_();
@@ -459,13 +581,13 @@ namespace exec {
 
       template <class _Uy>
         requires convertible_to<_Uy*, _Ty*>
-      __dynamic_delete(std::default_delete<_Uy>)
-        : __delete_([](_Ty* __p) { delete static_cast<_Uy*>(__p); }) {
+      __dynamic_delete(__allocator_delete<_Uy>)
+        : __delete_([](_Ty* __p) { __allocator_delete<_Uy>{}(static_cast<_Uy*>(__p)); }) {
       }
 
       template <class _Uy>
         requires convertible_to<_Uy*, _Ty*>
-      auto operator=(std::default_delete<_Uy> __d) -> __dynamic_delete& {
+      auto operator=(__allocator_delete<_Uy> __d) -> __dynamic_delete& {
         __delete_ = __dynamic_delete{__d}.__delete_;
         return *this;
       }
@@ -667,13 +789,13 @@ namespace exec {
        private:
         friend struct async_scope;
 
-        explicit __t(std::unique_ptr<__future_state<_Sender, _Env>> __state) noexcept
+        explicit __t(__future_state_ptr<_Sender, _Env> __state) noexcept
           : __state_(std::move(__state)) {
           std::unique_lock __guard{__state_->__mutex_};
           __state_->__step_from_to_(__guard, __future_step::__created, __future_step::__future);
         }
 
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        __future_state_ptr<_Sender, _Env> __state_;
       };
     };
 
@@ -751,7 +873,9 @@ namespace exec {
             >{__env::__join(
                 static_cast<_Env&&>(__env),
                 __spawn_env_{__scope->__stop_source_.get_token()}),
-              [](__spawn_op_base<_EnvId>* __op) { delete static_cast<__t*>(__op); }}
+              [](__spawn_op_base<_EnvId>* __op) {
+                __allocator_delete<__t>{}(static_cast<__t*>(__op));
+              }}
           , __data_(static_cast<_Sender&&>(__sndr), __spawn_receiver_t<_Env>{this}) {
         }
 
@@ -780,6 +904,13 @@ namespace exec {
     struct async_scope : __immovable {
       async_scope() = default;
 
+      // Counts the active operations in `__num_shards` counters, rounded up to a power of two,
+      // instead of a single one that all threads contend on. Waiting for the scope to become
+      // empty then has to sum up all shards on every completion.
+      explicit async_scope(std::size_t __num_shards)
+        : __impl_(__num_shards) {
+      }
+
       template <sender _Constrained>
       [[nodiscard]]
       auto when_empty(_Constrained&& __c) const -> __when_empty_sender_t<_Constrained> {
@@ -806,19 +937,40 @@ namespace exec {
         using __op_t = __spawn_operation_t<nest_result_t<_Sender>, _Env>;
         // this will connect and start the operation, after which the operation state is
         // responsible for deleting itself after it completes.
-        [[maybe_unused]]
-        auto* __op =
-          new __op_t{nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_};
+        if constexpr (__callable<get_allocator_t, _Env&>) {
+          auto __alloc = stdexec::get_allocator(__env);
+          __allocate_construct<__op_t>(
+            __alloc, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_);
+        } else {
+          [[maybe_unused]]
+          auto* __op =
+            new __op_t{nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_};
+        }
       }
 
       template <__movable_value _Env = env<>, sender_in<__env_t<_Env>> _Sender>
       auto spawn_future(_Sender&& __sndr, _Env __env = {}) -> __future_t<_Sender, _Env> {
         using __state_t = __future_state<nest_result_t<_Sender>, _Env>;
-        auto __state = std::make_unique<__state_t>(
-          nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_);
+        __future_state_ptr<nest_result_t<_Sender>, _Env> __state;
+        if constexpr (__callable<get_allocator_t, _Env&>) {
+          auto __alloc = stdexec::get_allocator(__env);
+          __state.reset(__allocate_construct<__state_t>(
+            __alloc, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_));
+        } else {
+          __state.reset(new __state_t(
+            nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_));
+        }
         return __future_t<_Sender, _Env>{std::move(__state)};
       }
 
+      // Returns an allocator that recycles the memory of completed operation states. Blocks are
+      // cached per thread rather than per scope, and a freed block goes back to the thread that
+      // allocated it, also when the operation completes elsewhere. Pass it to `spawn` as
+      // `prop{get_allocator, scope.get_recycling_allocator()}`.
+      auto get_recycling_allocator() const noexcept -> __recycling_allocator<std::byte> {
+        return {};
+      }
+
       auto get_stop_source() noexcept -> inplace_stop_source& {
         return __impl_.__stop_source_;
       }
@@ -23,10 +23,13 @@
 
 #  include "../../stdexec/execution.hpp"
 #  include "../timed_scheduler.hpp"
+#  include "../sequence_senders.hpp"
 
 #  include "../__detail/__atomic_intrusive_queue.hpp"
 #  include "../__detail/__atomic_ref.hpp"
 #  include "../__detail/__bit_cast.hpp"
+#  include "../../stdexec/__detail/__allocator.hpp"
+#  include "../../stdexec/__detail/__spin_loop_pause.hpp"
 
 #  include "./safe_file_descriptor.hpp"
 #  include "./memory_mapped_region.hpp"
@@ -47,14 +50,35 @@
 
 #    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
 #      define STDEXEC_HAS_IORING_OP_READ
+#      define STDEXEC_HAS_IORING_SOCKET_OPS
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 18, 0)
+#      define STDEXEC_HAS_IORING_MSG_RING
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 19, 0)
+#      define STDEXEC_HAS_IORING_MULTISHOT
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+#      define STDEXEC_HAS_IORING_RECV_MULTISHOT
 #    endif
 
 #    include <sys/uio.h>
 #    include <sys/eventfd.h>
+#    include <sys/socket.h>
 #    include <sys/syscall.h>
 
 #    include <algorithm>
+#    include <array>
 #    include <cstring>
+#    include <mutex>
+#    include <span>
+#    include <system_error>
+#    include <tuple>
+#    include <utility>
+#    include <vector>
 
 namespace exec {
   namespace __io_uring {
@@ -87,6 +111,20 @@ namespace exec {
       }
     }
 
+    inline auto __io_uring_register(
+      int __ring_fd,
+      unsigned int __opcode,
+      const void* __arg,
+      unsigned int __nr_args) -> int {
+      int rc = static_cast<int>(
+        ::syscall(__NR_io_uring_register, __ring_fd, __opcode, __arg, __nr_args));
+      if (rc == -1) {
+        return -errno;
+      } else {
+        return rc;
+      }
+    }
+
     inline auto
       __map_region(int __fd, ::off_t __offset, std::size_t __size) -> memory_mapped_region {
       void* __ptr =
@@ -95,10 +133,34 @@ namespace exec {
       return memory_mapped_region{__ptr, __size};
     }
 
+    /// @brief Setup parameters of an io_uring_context.
+    struct __options {
+      /// Additional IORING_SETUP_* flags that are passed to io_uring_setup.
+      unsigned flags = 0;
+      /// Let a kernel thread poll the submission queue (IORING_SETUP_SQPOLL).
+      /// Submissions then need no system call as long as the kernel thread is awake.
+      bool sq_poll = false;
+      /// Milliseconds of idleness after which the submission queue thread goes to sleep.
+      unsigned sq_thread_idle = 0;
+      /// Pins the submission queue thread to the given cpu (IORING_SETUP_SQ_AFF).
+      std::optional<unsigned> sq_thread_cpu = std::nullopt;
+      /// Busy-poll for completions instead of waiting for interrupts (IORING_SETUP_IOPOLL).
+      /// The kernel supports this only for reads and writes on files opened with O_DIRECT.
+      /// Timers are not available and the thread that drives the context spins while it runs.
+      bool io_poll = false;
+      /// Shares the kernel's async workers with the ring of the given file descriptor
+      /// (IORING_SETUP_ATTACH_WQ), see io_uring_context::native_handle().
+      std::optional<int> attach_wq = std::nullopt;
+    };
+
     // This base class maps the kernel's io_uring data structures into the process.
     struct __context_base : stdexec::__immovable {
       explicit __context_base(unsigned __entries, unsigned __flags = 0)
-        : __params_{__context_base::__init_params(__flags)}
+        : __context_base(__entries, __options{.flags = __flags}) {
+      }
+
+      explicit __context_base(unsigned __entries, const __options& __opts)
+        : __params_{__context_base::__init_params(__opts)}
         , __ring_fd_{__io_uring_setup(__entries, __params_)}
         , __eventfd_{::eventfd(0, EFD_CLOEXEC)} {
         __throw_error_code_if(!__eventfd_, errno);
@@ -116,9 +178,24 @@ namespace exec {
         }
       }
 
-      static auto __init_params(unsigned __flags) noexcept -> ::io_uring_params {
+      static auto __init_params(const __options& __opts) noexcept -> ::io_uring_params {
         ::io_uring_params __params{};
-        __params.flags = __flags;
+        __params.flags = __opts.flags;
+        if (__opts.sq_poll) {
+          __params.flags |= IORING_SETUP_SQPOLL;
+          __params.sq_thread_idle = __opts.sq_thread_idle;
+          if (__opts.sq_thread_cpu) {
+            __params.flags |= IORING_SETUP_SQ_AFF;
+            __params.sq_thread_cpu = *__opts.sq_thread_cpu;
+          }
+        }
+        if (__opts.io_poll) {
+          __params.flags |= IORING_SETUP_IOPOLL;
+        }
+        if (__opts.attach_wq) {
+          __params.flags |= IORING_SETUP_ATTACH_WQ;
+          __params.wq_fd = static_cast<__u32>(*__opts.attach_wq);
+        }
         return __params;
       }
 
@@ -133,6 +210,23 @@ namespace exec {
       safe_file_descriptor __eventfd_{};
     };
 
+    /// Refers to a slot in the file table registered by io_uring_context::register_files().
+    struct registered_file {
+      unsigned index;
+    };
+
+    /// Refers to a range within a buffer registered by io_uring_context::register_buffers().
+    struct registered_buffer {
+      std::span<std::byte> data;
+      __u16 index;
+
+      [[nodiscard]]
+      auto subspan(std::size_t __offset, std::size_t __count = std::dynamic_extent) const noexcept
+        -> registered_buffer {
+        return registered_buffer{data.subspan(__offset, __count), index};
+      }
+    };
+
     struct __task;
 
     // Each io operation provides the following interface:
@@ -187,6 +281,7 @@ namespace exec {
     class __submission_queue {
       __atomic_ref<__u32> __head_;
       __atomic_ref<__u32> __tail_;
+      __atomic_ref<__u32> __flags_;
       __u32* __array_;
       ::io_uring_sqe* __entries_;
       __u32 __mask_;
@@ -198,12 +293,21 @@ namespace exec {
         const ::io_uring_params& __params)
         : __head_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.head)}
         , __tail_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.tail)}
+        , __flags_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.flags)}
         , __array_{__at_offset_as<__u32*>(__region.data(), __params.sq_off.array)}
         , __entries_{static_cast<::io_uring_sqe*>(__sqes_region.data())}
         , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.ring_mask)}
         , __n_total_slots_{__params.sq_entries} {
       }
 
+      // In SQPOLL mode, this returns true if the kernel thread went to sleep and has to be woken up
+      // with IORING_ENTER_SQ_WAKEUP. The fence orders the preceding tail update before the load.
+      [[nodiscard]]
+      auto needs_wakeup() const noexcept -> bool {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return __flags_.load(std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP;
+      }
+
       // This function submits the given queue of tasks to the io_uring.
 
       // Each task that is ready to be completed is moved to the __ready queue.
@@ -212,6 +316,9 @@ namespace exec {
       // If is_stopped is true, no new tasks are submitted to the io_uring unless it is a cancellation.
       // If is_stopped is true and a task is not ready to be completed, the task is completed with
       // an io_uring_cqe object with the result field set to -ECANCELED.
+      // Tasks that fill in IOSQE_IO_LINK start a chain that ends with the next task without it.
+      // A chain is only submitted as a whole. If it does not fit, it is moved back to the front
+      // of the __pending queue.
       auto submit(__task_queue __tasks, __u32 __max_submissions, bool __is_stopped) noexcept
         -> __submission_result {
         __u32 __tail = __tail_.load(std::memory_order_relaxed);
@@ -221,6 +328,8 @@ namespace exec {
         __max_submissions = std::min(__max_submissions, __n_total_slots_ - __current_count);
         __submission_result __result{};
         __task* __op = nullptr;
+        __task_queue __chain{};
+        __u32 __chain_tail = __tail;
         while (!__tasks.empty() && __result.__n_submitted < __max_submissions) {
           const __u32 __index = __tail & __mask_;
           ::io_uring_sqe& __sqe = __entries_[__index];
@@ -238,11 +347,24 @@ namespace exec {
             } else {
               __sqe.user_data = bit_cast<__u64>(__op);
               __array_[__index] = __index;
+              if (__sqe.flags & IOSQE_IO_LINK) {
+                if (__chain.empty()) {
+                  __chain_tail = __tail;
+                }
+                __chain.push_back(__op);
+              } else {
+                __chain.clear();
+              }
               ++__result.__n_submitted;
               ++__tail;
             }
           }
         }
+        if (!__chain.empty()) {
+          __result.__n_submitted -= __tail - __chain_tail;
+          __tail = __chain_tail;
+          __tasks.prepend(static_cast<__task_queue&&>(__chain));
+        }
         __tail_.store(__tail, std::memory_order_release);
         while (!__tasks.empty()) {
           __op = __tasks.pop_front();
@@ -271,6 +393,24 @@ namespace exec {
         , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.ring_mask)} {
       }
 
+      [[nodiscard]]
+      auto empty() const noexcept -> bool {
+        return __head_.load(std::memory_order_relaxed) == __tail_.load(std::memory_order_acquire);
+      }
+
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+      // Returns true if the caller has to post a wakeup completion to this queue. Otherwise, a
+      // wakeup is already on its way and the owner of the ring will look for new requests after it
+      // has consumed that wakeup.
+      auto __try_mark_remote_wakeup() noexcept -> bool {
+        return !__remote_wakeup_pending_.exchange(true, std::memory_order_acq_rel);
+      }
+
+      void __clear_remote_wakeup() noexcept {
+        __remote_wakeup_pending_.store(false, std::memory_order_release);
+      }
+#    endif
+
       // This function first completes all tasks that are ready in the completion queue of the io_uring.
       // Then it completes all tasks that are ready in the given queue of ready tasks.
       // The function returns the number of previously submitted completed tasks.
@@ -282,10 +422,21 @@ namespace exec {
         while (__head != __tail) {
           const __u32 __index = __head & __mask_;
           const ::io_uring_cqe& __cqe = __entries_[__index];
+          ++__head;
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+          if (__cqe.user_data == 0) {
+            // A wakeup that another ring posted with IORING_OP_MSG_RING. It has not been submitted
+            // by this ring and does not count as a completion.
+            __remote_wakeup_pending_.exchange(false, std::memory_order_acq_rel);
+            __tail = __tail_.load(std::memory_order_acquire);
+            continue;
+          }
+#    endif
           auto* __op = bit_cast<__task*>(__cqe.user_data);
+          // A multishot operation stays submitted as long as its completions carry F_MORE.
+          const bool __is_last = !(__cqe.flags & IORING_CQE_F_MORE);
           __op->__vtable_->__complete_(__op, __cqe);
-          ++__head;
-          ++__count;
+          __count += __is_last;
           __tail = __tail_.load(std::memory_order_acquire);
         }
         __head_.store(__head, std::memory_order_release);
@@ -297,6 +448,11 @@ namespace exec {
         }
         return __count;
       }
+
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+     private:
+      std::atomic<bool> __remote_wakeup_pending_{false};
+#    endif
     };
 
     class __context;
@@ -345,7 +501,38 @@ namespace exec {
       void start() & noexcept;
     };
 
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+    // Wakes up a ring from the thread that drives another ring. This operation is submitted to the
+    // ring of the current thread and posts a completion with user_data 0 into the completion queue
+    // of the target ring (IORING_OP_MSG_RING), which saves the eventfd write and the completion of
+    // the wakeup operation.
+    //
+    // The operation is owned by the target, which waits in its destructor until the operation is
+    // no longer busy. The target reserves an entry of its completion queue for the posted
+    // completion.
+    struct __msg_ring_operation : __task {
+      __context* __target_ = nullptr;
+      std::atomic<bool> __is_busy_{false};
+
+      static auto __ready_(__task*) noexcept -> bool {
+        return false;
+      }
+
+      static void __submit_(__task* __pointer, ::io_uring_sqe& __entry) noexcept;
+
+      static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept;
+
+      static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+      explicit __msg_ring_operation(__context* __target) noexcept
+        : __task{__vtable}
+        , __target_{__target} {
+      }
+    };
+#    endif
+
     class __scheduler;
+    class __buffer_ring;
 
     enum class until {
       stopped,
@@ -355,18 +542,37 @@ namespace exec {
     class __context : __context_base {
      public:
       explicit __context(unsigned __entries = 1024, unsigned __flags = 0)
-        : __context_base(std::max(__entries, 2u), __flags)
+        : __context(__entries, __options{.flags = __flags}) {
+      }
+
+      explicit __context(unsigned __entries, const __options& __opts)
+        : __context_base(std::max(__entries, 2u), __opts)
         , __completion_queue_{__completion_queue_region_ ? __completion_queue_region_ : __submission_queue_region_, __params_}
         , __submission_queue_{__submission_queue_region_, __submission_queue_entries_, __params_}
-        , __wakeup_operation_{this, __eventfd_} {
+        , __wakeup_operation_{this, __eventfd_}
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+        , __msg_ring_operation_{this}
+#    endif
+      {
+      }
+
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+      // A wakeup of this context that has been submitted to another ring refers to this context
+      // until that ring completes it. The other ring has to be driven until then.
+      ~__context() {
+        while (__msg_ring_operation_.__is_busy_.load(std::memory_order_acquire)) {
+          stdexec::__spin_loop_pause();
+        }
       }
+#    endif
 
       auto try_wakeup() noexcept -> std::error_code {
-        std::uint64_t __wakeup = 1;
-        if (::write(__eventfd_, &__wakeup, sizeof(__wakeup)) == -1) {
-          return {errno, std::system_category()};
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+        if (__try_wakeup_from_ring()) {
+          return {};
         }
-        return {};
+#    endif
+        return __wakeup_eventfd();
       }
 
       void wakeup() {
@@ -403,6 +609,21 @@ namespace exec {
         return __is_running_.load(std::memory_order_relaxed);
       }
 
+      /// @brief Returns true if a kernel thread polls the submission queue.
+      auto is_sq_polled() const noexcept -> bool {
+        return __params_.flags & IORING_SETUP_SQPOLL;
+      }
+
+      /// @brief Returns true if completions are busy-polled.
+      auto is_io_polled() const noexcept -> bool {
+        return __params_.flags & IORING_SETUP_IOPOLL;
+      }
+
+      /// @brief Returns the file descriptor of the io_uring instance.
+      auto native_handle() const noexcept -> int {
+        return __ring_fd_;
+      }
+
       /// @brief  Breaks out of the run loop of the io context without stopping the context.
       void finish() {
         __break_loop_.store(true, std::memory_order_release);
@@ -435,6 +656,61 @@ namespace exec {
         }
       }
 
+      /// \brief Submits the given task and wakes up the thread that drives this context.
+      /// \returns the error of a failed wakeup. The task stays submitted in that case and is
+      /// picked up the next time this context is woken up.
+      auto __submit_and_wakeup(__task* __op) noexcept -> std::error_code {
+        if (submit(__op)) {
+          return try_wakeup();
+        }
+        return {};
+      }
+
+      /// \brief Submits the given tasks like submit(__task_queue) and wakes up the thread that
+      /// drives this context.
+      /// \returns the error of a failed wakeup, see __submit_and_wakeup(__task*).
+      auto __submit_and_wakeup(__task_queue __tasks) noexcept -> std::error_code {
+        if (submit(static_cast<__task_queue&&>(__tasks))) {
+          return try_wakeup();
+        }
+        return {};
+      }
+
+      /// \brief The maximum number of linked tasks that can be submitted as one chain. A longer
+      /// chain would never fit into the submission queue or the completion budget of this ring.
+      [[nodiscard]]
+      auto __max_chain_length() const noexcept -> std::size_t {
+        return std::min<std::size_t>(__params_.sq_entries, __cq_budget());
+      }
+
+      /// \brief Submits the given tasks to the io_uring such that they occupy consecutive entries
+      /// of the submission queue.
+      /// \returns true if the tasks were submitted, false if this io context has been stopped.
+      auto submit(__task_queue __tasks) noexcept -> bool {
+        int __n = 0;
+        while (__n != __no_new_submissions
+               && !__n_submissions_in_flight_.compare_exchange_weak(
+                 __n, __n + 1, std::memory_order_acquire, std::memory_order_relaxed))
+          ;
+        if (__n == __no_new_submissions) {
+          while (!__tasks.empty()) {
+            __stop(__tasks.pop_front());
+          }
+          return false;
+        } else {
+          // The request queue is drained in reverse order.
+          __task_queue __reversed{};
+          while (!__tasks.empty()) {
+            __reversed.push_front(__tasks.pop_front());
+          }
+          __requests_.prepend(static_cast<__task_queue&&>(__reversed));
+          [[maybe_unused]]
+          int __prev = __n_submissions_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+          STDEXEC_ASSERT(__prev > 0);
+          return true;
+        }
+      }
+
       /// @brief Submit any pending tasks and complete any ready tasks.
       ///
       /// This function is not thread-safe and must only be called from the thread that drives the io context.
@@ -443,7 +719,7 @@ namespace exec {
         STDEXEC_ASSERT(
           0 <= __n_total_submitted_
           && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
-        __u32 __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
+        __u32 __max_submissions = __cq_budget() - static_cast<__u32>(__n_total_submitted_);
         __pending_.append(__requests_.pop_all_reversed());
         __submission_result __result = __submission_queue_.submit(
           static_cast<__task_queue&&>(__pending_),
@@ -458,7 +734,7 @@ namespace exec {
                                     .complete(static_cast<__task_queue&&>(__result.__ready));
           STDEXEC_ASSERT(0 <= __n_total_submitted_);
           __pending_.append(__requests_.pop_all_reversed());
-          __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
+          __max_submissions = __cq_budget() - static_cast<__u32>(__n_total_submitted_);
           __result = __submission_queue_.submit(
             static_cast<__task_queue&&>(__pending_),
             __max_submissions,
@@ -485,39 +761,23 @@ namespace exec {
             __stop_source_.emplace();
             // Make emplacement of stop source visible to other threads and open the door for new submissions.
             __n_submissions_in_flight_.store(0, std::memory_order_release);
-          } else {
+          } else if (!is_io_polled()) {
             // This can only happen for the very first pass of run_until_stopped()
+            // A polled ring cannot wait on the eventfd, its run loop spins on the request queue.
             __wakeup_operation_.start();
           }
         }
         scope_guard __not_running{
           [&]() noexcept { __is_running_.store(false, std::memory_order_relaxed); }};
+        scope_guard __restore_thread_context{
+          [__previous = std::exchange(__this_thread_context(), this)]() noexcept {
+            __this_thread_context() = __previous;
+          }};
         __pending_.append(__requests_.pop_all_reversed());
-        while (__n_total_submitted_ > 0 || !__pending_.empty()) {
-          run_some();
-          if (
-            __n_total_submitted_ == 0
-            || (__n_total_submitted_ == 1 && __break_loop_.load(std::memory_order_acquire))) {
-            __break_loop_.store(false, std::memory_order_relaxed);
-            break;
-          }
-          constexpr int __min_complete = 1;
-          STDEXEC_ASSERT(
-            0 <= __n_total_submitted_
-            && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
-          int rc = __io_uring_enter(
-            __ring_fd_,
-            static_cast<unsigned>(__n_newly_submitted_),
-            __min_complete,
-            IORING_ENTER_GETEVENTS);
-          __throw_error_code_if(rc < 0 && rc != -EINTR, -rc);
-          if (rc != -EINTR) {
-            STDEXEC_ASSERT(rc <= __n_newly_submitted_);
-            __n_newly_submitted_ -= rc;
-          }
-          __n_total_submitted_ -= __completion_queue_.complete();
-          STDEXEC_ASSERT(0 <= __n_total_submitted_);
-          __pending_.append(__requests_.pop_all_reversed());
+        if (is_io_polled()) {
+          __run_polled();
+        } else {
+          __run_waiting();
         }
         STDEXEC_ASSERT(__n_total_submitted_ <= 1);
         if (__stop_source_->stop_requested() && __pending_.empty()) {
@@ -537,7 +797,7 @@ namespace exec {
           // and then stop it, finally.
           __pending_.append(__requests_.pop_all_reversed());
           __submission_result __result = __submission_queue_.submit(
-            static_cast<__task_queue&&>(__pending_), __params_.cq_entries, true);
+            static_cast<__task_queue&&>(__pending_), __cq_budget(), true);
           STDEXEC_ASSERT(__result.__n_submitted == 0);
           STDEXEC_ASSERT(__result.__pending.empty());
           __completion_queue_.complete(static_cast<__task_queue&&>(__result.__ready));
@@ -628,8 +888,224 @@ namespace exec {
 
       auto get_scheduler() noexcept -> __scheduler;
 
+      /// @brief Registers the given buffers with the kernel (IORING_REGISTER_BUFFERS).
+      ///
+      /// Registered buffers are pinned once instead of once per operation. The buffers must stay
+      /// alive until they are unregistered or the context is destroyed. Only one set of buffers can
+      /// be registered at a time. This function is not thread-safe.
+      void register_buffers(std::span<const ::iovec> __buffers) {
+        std::vector<::iovec> __registered(__buffers.begin(), __buffers.end());
+        int __rc = __io_uring_register(
+          __ring_fd_,
+          IORING_REGISTER_BUFFERS,
+          __registered.data(),
+          static_cast<unsigned>(__registered.size()));
+        __throw_error_code_if(__rc < 0, -__rc);
+        __registered_buffers_ = static_cast<std::vector<::iovec>&&>(__registered);
+      }
+
+      /// @brief Allocates @p __count buffers of @p __size bytes each and registers them.
+      ///
+      /// The buffers are backed by an anonymous memory mapping that is owned by this context.
+      void register_buffers(std::size_t __count, std::size_t __size) {
+        void* __ptr = ::mmap(
+          nullptr,
+          __count * __size,
+          PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+          -1,
+          0);
+        __throw_error_code_if(__ptr == MAP_FAILED, errno);
+        memory_mapped_region __pool{__ptr, __count * __size};
+        std::vector<::iovec> __buffers(__count);
+        for (std::size_t __i = 0; __i < __count; ++__i) {
+          __buffers[__i].iov_base = static_cast<std::byte*>(__ptr) + __i * __size;
+          __buffers[__i].iov_len = __size;
+        }
+        register_buffers(__buffers);
+        __buffer_pool_ = static_cast<memory_mapped_region&&>(__pool);
+      }
+
+      /// @brief Returns the registered buffer at @p __index.
+      [[nodiscard]]
+      auto registered_buffer_at(std::size_t __index) const noexcept -> registered_buffer {
+        STDEXEC_ASSERT(__index < __registered_buffers_.size());
+        const ::iovec& __iov = __registered_buffers_[__index];
+        return registered_buffer{
+          std::span{static_cast<std::byte*>(__iov.iov_base), __iov.iov_len},
+          static_cast<__u16>(__index)};
+      }
+
+      [[nodiscard]]
+      auto registered_buffer_count() const noexcept -> std::size_t {
+        return __registered_buffers_.size();
+      }
+
+      void unregister_buffers() {
+        int __rc = __io_uring_register(__ring_fd_, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        __throw_error_code_if(__rc < 0, -__rc);
+        __registered_buffers_.clear();
+        __buffer_pool_ = memory_mapped_region{};
+      }
+
+      /// @brief Registers a table of file descriptors with the kernel (IORING_REGISTER_FILES).
+      ///
+      /// Operations on a registered_file skip the per-operation file reference counting.
+      /// Entries of -1 leave the slot empty. This function is not thread-safe.
+      void register_files(std::span<const int> __fds) {
+        int __rc = __io_uring_register(
+          __ring_fd_, IORING_REGISTER_FILES, __fds.data(), static_cast<unsigned>(__fds.size()));
+        __throw_error_code_if(__rc < 0, -__rc);
+      }
+
+      /// @brief Replaces the registered files starting at slot @p __offset.
+      void update_registered_files(unsigned __offset, std::span<const int> __fds) {
+        ::io_uring_files_update __update{};
+        __update.offset = __offset;
+        __update.fds = bit_cast<__u64>(__fds.data());
+        int __rc = __io_uring_register(
+          __ring_fd_, IORING_REGISTER_FILES_UPDATE, &__update, static_cast<unsigned>(__fds.size()));
+        __throw_error_code_if(__rc < 0, -__rc);
+      }
+
+      void unregister_files() {
+        int __rc = __io_uring_register(__ring_fd_, IORING_UNREGISTER_FILES, nullptr, 0);
+        __throw_error_code_if(__rc < 0, -__rc);
+      }
+
      private:
       friend struct __wakeup_operation;
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+      friend struct __msg_ring_operation;
+#    endif
+      friend class __buffer_ring;
+
+      // The number of completion queue entries that submissions of this ring may occupy.
+      auto __cq_budget() const noexcept -> __u32 {
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+        // One entry is reserved for the wakeup that another ring posts with IORING_OP_MSG_RING.
+        // There is at most one such wakeup in the queue at any time, see __try_wakeup_from_ring.
+        return __params_.cq_entries - 1;
+#    else
+        return __params_.cq_entries;
+#    endif
+      }
+
+      // Returns the context that is driven by the calling thread, if any.
+      static auto __this_thread_context() noexcept -> __context*& {
+        thread_local __context* __context = nullptr;
+        return __context;
+      }
+
+      auto __wakeup_eventfd() noexcept -> std::error_code {
+        std::uint64_t __wakeup = 1;
+        while (::write(__eventfd_, &__wakeup, sizeof(__wakeup)) == -1) {
+          if (errno != EINTR) {
+            return {errno, std::system_category()};
+          }
+        }
+        return {};
+      }
+
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+      // If the calling thread drives another ring, let that ring post the wakeup into our
+      // completion queue. Returns false if the caller has to fall back to the eventfd.
+      auto __try_wakeup_from_ring() noexcept -> bool {
+        __context* __current = __this_thread_context();
+        if (__current == nullptr || __current == this || is_io_polled()) {
+          return false;
+        }
+        if (!__completion_queue_.__try_mark_remote_wakeup()) {
+          return true;
+        }
+        if (__msg_ring_operation_.__is_busy_.exchange(true, std::memory_order_acquire)) {
+          __completion_queue_.__clear_remote_wakeup();
+          return false;
+        }
+        // The current thread submits the message with its next call to io_uring_enter.
+        __current->submit(&__msg_ring_operation_);
+        return true;
+      }
+#    endif
+
+      // Tells the kernel about newly submitted entries and waits for at least @p __min_complete
+      // completions.
+      void __enter(unsigned __min_complete) {
+        unsigned __flags = __min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+        unsigned __to_submit = static_cast<unsigned>(__n_newly_submitted_);
+        if (is_sq_polled()) {
+          // The kernel thread consumes the submission queue on its own.
+          __n_newly_submitted_ = 0;
+          __to_submit = 0;
+          if (__submission_queue_.needs_wakeup()) {
+            __flags |= IORING_ENTER_SQ_WAKEUP;
+          } else if (__min_complete == 0) {
+            return;
+          }
+        }
+        if (is_io_polled()) {
+          // Completions of a polled ring are only reaped by io_uring_enter with GETEVENTS.
+          __flags |= IORING_ENTER_GETEVENTS;
+        }
+        int rc = __io_uring_enter(__ring_fd_, __to_submit, __min_complete, __flags);
+        __throw_error_code_if(rc < 0 && rc != -EINTR, -rc);
+        if (rc != -EINTR) {
+          STDEXEC_ASSERT(rc <= __n_newly_submitted_ || is_sq_polled());
+          __n_newly_submitted_ -= std::min<std::ptrdiff_t>(rc, __n_newly_submitted_);
+        }
+      }
+
+      // The run loop for interrupt driven rings. It sleeps in io_uring_enter until at least one
+      // completion is available. The wakeup operation guarantees that new requests or stop requests
+      // from other threads interrupt the sleep.
+      void __run_waiting() {
+        while (__n_total_submitted_ > 0 || !__pending_.empty()) {
+          run_some();
+          if (
+            __n_total_submitted_ == 0
+            || (__n_total_submitted_ == 1 && __break_loop_.load(std::memory_order_acquire))) {
+            __break_loop_.store(false, std::memory_order_relaxed);
+            break;
+          }
+          STDEXEC_ASSERT(
+            0 <= __n_total_submitted_
+            && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
+          if (is_sq_polled() && !__completion_queue_.empty()) {
+            // The kernel thread has already produced new completions, don't enter the kernel.
+            continue;
+          }
+          constexpr unsigned __min_complete = 1;
+          __enter(__min_complete);
+          __n_total_submitted_ -= __completion_queue_.complete();
+          STDEXEC_ASSERT(0 <= __n_total_submitted_);
+          __pending_.append(__requests_.pop_all_reversed());
+        }
+      }
+
+      // The run loop for IOPOLL rings. Completions have to be reaped actively and there is no
+      // wakeup operation, so the loop spins until it is stopped or, in run_until_empty(), runs out
+      // of work.
+      void __run_polled() {
+        while (true) {
+          run_some();
+          if (__n_total_submitted_ == 0 && __pending_.empty()) {
+            if (__stop_source_->stop_requested()) {
+              break;
+            }
+            if (__break_loop_.load(std::memory_order_acquire)) {
+              __break_loop_.store(false, std::memory_order_relaxed);
+              break;
+            }
+            stdexec::__spin_loop_pause();
+          } else {
+            constexpr unsigned __min_complete = 0;
+            __enter(__min_complete);
+            __n_total_submitted_ -= __completion_queue_.complete();
+            STDEXEC_ASSERT(0 <= __n_total_submitted_);
+          }
+          __pending_.append(__requests_.pop_all_reversed());
+        }
+      }
 
       // This constant is used for __n_submissions_in_flight to indicate that no new submissions
       // to this context will be completed by this context.
@@ -646,6 +1122,11 @@ namespace exec {
       __task_queue __pending_{};
       __atomic_task_queue __requests_{};
       __wakeup_operation __wakeup_operation_;
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+      __msg_ring_operation __msg_ring_operation_;
+#    endif
+      std::vector<::iovec> __registered_buffers_{};
+      memory_mapped_region __buffer_pool_{};
     };
 
     inline void __wakeup_operation::start() & noexcept {
@@ -654,66 +1135,312 @@ namespace exec {
       }
     }
 
-    template <class _Op>
-    concept __io_task = requires(_Op& __op, ::io_uring_sqe& __sqe, const ::io_uring_cqe& __cqe) {
-      { __op.context() } noexcept -> std::convertible_to<__context&>;
-      { __op.ready() } noexcept -> std::convertible_to<bool>;
-      { __op.submit(__sqe) } noexcept;
-      { __op.complete(__cqe) } noexcept;
-    };
+#    ifdef STDEXEC_HAS_IORING_MSG_RING
+    inline void
+      __msg_ring_operation::__submit_(__task* __pointer, ::io_uring_sqe& __entry) noexcept {
+      auto& __self = *static_cast<__msg_ring_operation*>(__pointer);
+      __entry = ::io_uring_sqe{};
+      __entry.opcode = IORING_OP_MSG_RING;
+      __entry.fd = __self.__target_->__ring_fd_;
+    }
 
-    template <class _Op>
-    concept __stoppable_task = __io_task<_Op> && requires(_Op& __op) {
-      {
-        static_cast<_Op &&>(__op).receiver()
-      } noexcept -> stdexec::receiver_of<stdexec::completion_signatures<stdexec::set_stopped_t()>>;
-    };
+    inline void
+      __msg_ring_operation::__complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+      auto& __self = *static_cast<__msg_ring_operation*>(__pointer);
+      __context& __target = *__self.__target_;
+      if (__cqe.res < 0) {
+        // The kernel does not support IORING_OP_MSG_RING or this ring has been stopped.
+        __target.__completion_queue_.__clear_remote_wakeup();
+        if (auto __ec = __target.__wakeup_eventfd()) {
+          std::terminate();
+        }
+      }
+      // The target may be destroyed as soon as the operation is no longer busy.
+      __self.__is_busy_.store(false, std::memory_order_release);
+    }
+#    endif
 
-    template <__stoppable_task _Op>
-    using __receiver_of_t = stdexec::__decay_t<decltype(std::declval<_Op&>().receiver())>;
+#    ifdef STDEXEC_HAS_IORING_MULTISHOT
+    class __provided_buffer;
 
-    template <__io_task _Base>
-    struct __io_task_facade : __task {
-      static auto __ready_(__task* __pointer) noexcept -> bool {
-        auto* __self = static_cast<__io_task_facade*>(__pointer);
-        return __self->__base_.ready();
+    /// @brief A ring of equally sized buffers from which the kernel picks when data arrives
+    /// (IORING_REGISTER_PBUF_RING).
+    ///
+    /// Buffers are only tied to an operation once data is received, so many idle receives can share
+    /// one ring. The ring must be destroyed before the context it is registered with.
+    class __buffer_ring : stdexec::__immovable {
+     public:
+      __buffer_ring(__context& __context, __u16 __group_id, __u16 __count, std::size_t __size)
+        : __ring_fd_{__context.__ring_fd_}
+        , __size_{__size}
+        , __group_id_{__group_id}
+        , __mask_{static_cast<__u16>(__count - 1)} {
+        if (__count == 0 || (__count & __mask_) != 0) {
+          STDEXEC_THROW(std::invalid_argument(
+            "exec::io_uring_buffer_ring: the number of buffers must be a power of two"));
+        }
+        __entries_ = __map_anonymous(__count * sizeof(::io_uring_buf));
+        __buffers_ = __map_anonymous(__count * __size);
+        ::io_uring_buf_reg __reg{};
+        __reg.ring_addr = bit_cast<__u64>(__entries_.data());
+        __reg.ring_entries = __count;
+        __reg.bgid = __group_id;
+        int __rc = __io_uring_register(__ring_fd_, IORING_REGISTER_PBUF_RING, &__reg, 1);
+        __throw_error_code_if(__rc < 0, -__rc);
+        for (__u16 __id = 0; __id < __count; ++__id) {
+          __push(__id);
+        }
+        __publish();
       }
 
-      static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
-        auto* __self = static_cast<__io_task_facade*>(__pointer);
-        __self->__base_.submit(__sqe);
+      ~__buffer_ring() {
+        ::io_uring_buf_reg __reg{};
+        __reg.bgid = __group_id_;
+        __io_uring_register(__ring_fd_, IORING_UNREGISTER_PBUF_RING, &__reg, 1);
       }
 
-      static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
-        auto* __self = static_cast<__io_task_facade*>(__pointer);
-        __self->__base_.complete(__cqe);
+      [[nodiscard]]
+      auto group_id() const noexcept -> __u16 {
+        return __group_id_;
       }
 
-      static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+      [[nodiscard]]
+      auto buffer_size() const noexcept -> std::size_t {
+        return __size_;
+      }
 
-      template <class... _Args>
-        requires stdexec::constructible_from<_Base, std::in_place_t, __task*, _Args...>
-      __io_task_facade(std::in_place_t, _Args&&... __args)
-        noexcept(stdexec::__nothrow_constructible_from<_Base, __task*, _Args...>)
-        : __task{__vtable}
-        , __base_(std::in_place, static_cast<__task*>(this), static_cast<_Args&&>(__args)...) {
+     private:
+      friend class __provided_buffer;
+
+      static auto __map_anonymous(std::size_t __size) -> memory_mapped_region {
+        void* __ptr = ::mmap(
+          nullptr,
+          __size,
+          PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+          -1,
+          0);
+        __throw_error_code_if(__ptr == MAP_FAILED, errno);
+        return memory_mapped_region{__ptr, __size};
       }
 
-      template <class... _Args>
-        requires stdexec::constructible_from<_Base, _Args...>
-      __io_task_facade(std::in_place_t, _Args&&... __args)
-        noexcept(stdexec::__nothrow_constructible_from<_Base, _Args...>)
-        : __task{__vtable}
-        , __base_(static_cast<_Args&&>(__args)...) {
+      auto __ring() const noexcept -> ::io_uring_buf_ring* {
+        return static_cast<::io_uring_buf_ring*>(__entries_.data());
       }
 
-      auto base() noexcept -> _Base& {
-        return __base_;
+      auto __buffer(__u16 __id) const noexcept -> std::byte* {
+        return static_cast<std::byte*>(__buffers_.data()) + __id * __size_;
+      }
+
+      void __push(__u16 __id) noexcept {
+        ::io_uring_buf& __buf = __ring()->bufs[__tail_ & __mask_];
+        __buf.addr = bit_cast<__u64>(__buffer(__id));
+        __buf.len = static_cast<__u32>(__size_);
+        __buf.bid = __id;
+        ++__tail_;
+      }
+
+      void __publish() noexcept {
+        __atomic_ref<__u16>{__ring()->tail}.store(__tail_, std::memory_order_release);
+      }
+
+      // Buffers may be handed back from any thread, the ring has a single producer slot.
+      void __recycle(__u16 __id) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        __push(__id);
+        __publish();
+      }
+
+      int __ring_fd_;
+      memory_mapped_region __entries_{};
+      memory_mapped_region __buffers_{};
+      std::size_t __size_;
+      __u16 __group_id_;
+      __u16 __mask_;
+      __u16 __tail_{0};
+      std::mutex __mutex_{};
+    };
+
+    /// @brief A buffer that the kernel filled from an io_uring_buffer_ring.
+    ///
+    /// The buffer is handed back to its ring when this object is destroyed or reset.
+    class __provided_buffer {
+      __buffer_ring* __ring_{nullptr};
+      std::size_t __size_{0};
+      __u16 __id_{0};
+
+     public:
+      __provided_buffer() = default;
+
+      __provided_buffer(__buffer_ring& __ring, __u16 __id, std::size_t __size) noexcept
+        : __ring_{&__ring}
+        , __size_{__size}
+        , __id_{__id} {
+      }
+
+      __provided_buffer(__provided_buffer&& __other) noexcept
+        : __ring_{std::exchange(__other.__ring_, nullptr)}
+        , __size_{__other.__size_}
+        , __id_{__other.__id_} {
+      }
+
+      auto operator=(__provided_buffer&& __other) noexcept -> __provided_buffer& {
+        if (this != &__other) {
+          reset();
+          __ring_ = std::exchange(__other.__ring_, nullptr);
+          __size_ = __other.__size_;
+          __id_ = __other.__id_;
+        }
+        return *this;
+      }
+
+      ~__provided_buffer() {
+        reset();
+      }
+
+      void reset() noexcept {
+        if (__ring_) {
+          std::exchange(__ring_, nullptr)->__recycle(__id_);
+        }
+      }
+
+      [[nodiscard]]
+      auto data() const noexcept -> std::span<std::byte> {
+        return __ring_ ? std::span{__ring_->__buffer(__id_), __size_} : std::span<std::byte>{};
+      }
+
+      [[nodiscard]]
+      auto id() const noexcept -> __u16 {
+        return __id_;
+      }
+
+      explicit operator bool() const noexcept {
+        return __ring_ != nullptr;
+      }
+    };
+#    endif
+
+    template <class _Op>
+    concept __io_task = requires(_Op& __op, ::io_uring_sqe& __sqe, const ::io_uring_cqe& __cqe) {
+      { __op.context() } noexcept -> std::convertible_to<__context&>;
+      { __op.ready() } noexcept -> std::convertible_to<bool>;
+      { __op.submit(__sqe) } noexcept;
+      { __op.complete(__cqe) } noexcept;
+    };
+
+    template <class _Op>
+    concept __stoppable_task = __io_task<_Op> && requires(_Op& __op) {
+      {
+        static_cast<_Op &&>(__op).receiver()
+      } noexcept -> stdexec::receiver_of<stdexec::completion_signatures<stdexec::set_stopped_t()>>;
+    };
+
+    template <__stoppable_task _Op>
+    using __receiver_of_t = stdexec::__decay_t<decltype(std::declval<_Op&>().receiver())>;
+
+    // Tasks that can complete with a std::error_code say so with a static
+    // `__completes_with_error_code` member. They complete with the error of a failed wakeup.
+    template <class _Op>
+    concept __reports_wakeup_errors = requires { requires _Op::__completes_with_error_code; };
+
+    // Keeps a submitted task from completing until __io_task_facade::start is done with it. The
+    // task completes once both references are released.
+    struct __wakeup_guard {
+      std::atomic<int> __n_refs_{0};
+      int __wakeup_errno_{0};
+      // Set if the task completed before start() was done with it. The task is then submitted
+      // again as a ready task, so that its result is still delivered on the thread of the context.
+      bool __redeliver_{false};
+      // The result of the completion queue entry of the task.
+      __s32 __res_{0};
+      __u32 __flags_{0};
+    };
+
+    struct __no_wakeup_guard { };
+
+    template <__io_task _Base>
+    struct __io_task_facade : __task {
+      static auto __ready_(__task* __pointer) noexcept -> bool {
+        auto* __self = static_cast<__io_task_facade*>(__pointer);
+        if constexpr (__reports_wakeup_errors<_Base>) {
+          if (__self->__guard_.__redeliver_) {
+            return true;
+          }
+        }
+        return __self->__base_.ready();
+      }
+
+      static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+        auto* __self = static_cast<__io_task_facade*>(__pointer);
+        __self->__base_.submit(__sqe);
+      }
+
+      static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+        auto* __self = static_cast<__io_task_facade*>(__pointer);
+        if constexpr (__reports_wakeup_errors<_Base>) {
+          if (!__self->__guard_.__redeliver_) {
+            __self->__guard_.__res_ = __cqe.res;
+            __self->__guard_.__flags_ = __cqe.flags;
+          }
+          if (__self->__guard_.__n_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            __self->__deliver();
+          }
+        } else {
+          __self->__base_.complete(__cqe);
+        }
+      }
+
+      static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+      template <class... _Args>
+        requires stdexec::constructible_from<_Base, std::in_place_t, __task*, _Args...>
+      __io_task_facade(std::in_place_t, _Args&&... __args)
+        noexcept(stdexec::__nothrow_constructible_from<_Base, __task*, _Args...>)
+        : __task{__vtable}
+        , __base_(std::in_place, static_cast<__task*>(this), static_cast<_Args&&>(__args)...) {
+      }
+
+      template <class... _Args>
+        requires stdexec::constructible_from<_Base, _Args...>
+      __io_task_facade(std::in_place_t, _Args&&... __args)
+        noexcept(stdexec::__nothrow_constructible_from<_Base, _Args...>)
+        : __task{__vtable}
+        , __base_(static_cast<_Args&&>(__args)...) {
+      }
+
+      auto base() noexcept -> _Base& {
+        return __base_;
       }
 
       void start() & noexcept {
         __context& __context = __base_.context();
-        if (__context.submit(this)) {
+        if constexpr (__reports_wakeup_errors<_Base>) {
+          // One reference for the completion and one for this function, so that the task cannot
+          // complete before a failed wakeup is recorded. The task stays submitted in that case and
+          // completes with the error once the context picks it up.
+          while (true) {
+            __guard_.__n_refs_.store(2, std::memory_order_relaxed);
+            if (!__context.submit(this)) {
+              // The context is stopped and the task has been completed with ECANCELED.
+              __guard_.__n_refs_.store(0, std::memory_order_relaxed);
+              __deliver();
+              return;
+            }
+            const std::error_code __ec = __context.try_wakeup();
+            if (__ec) {
+              __guard_.__wakeup_errno_ = __ec.value();
+            }
+            if (__guard_.__n_refs_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+              return;
+            }
+            if (__ec) {
+              // The context cannot be woken up to deliver the error.
+              __deliver();
+              return;
+            }
+            __guard_.__redeliver_ = true;
+          }
+        } else if (__context.submit(this)) {
           if (auto __ec = __context.try_wakeup()) {
             std::terminate(); // TODO: handle error
           }
@@ -721,7 +1448,25 @@ namespace exec {
       }
 
      private:
+      void __deliver() noexcept {
+        ::io_uring_cqe __cqe{};
+        __cqe.user_data = bit_cast<__u64>(static_cast<__task*>(this));
+        __cqe.res = __guard_.__res_;
+        __cqe.flags = __guard_.__flags_;
+        if (__guard_.__wakeup_errno_ != 0) {
+          // Release what the task produced and report the failed wakeup instead.
+          if (__cqe.res >= 0) {
+            __base_.discard(__cqe);
+          }
+          __cqe.res = -__guard_.__wakeup_errno_;
+        }
+        __base_.complete(__cqe);
+      }
+
       _Base __base_;
+      STDEXEC_ATTRIBUTE(no_unique_address)
+      std::conditional_t<__reports_wakeup_errors<_Base>, __wakeup_guard, __no_wakeup_guard>
+        __guard_{};
     };
 
     template <class _ReceiverId>
@@ -866,6 +1611,8 @@ namespace exec {
       using __base_t = __impl_base<_Base, __has_submit_stop_v<_Base>>;
 
       struct __impl : __base_t {
+        static constexpr bool __completes_with_error_code = __reports_wakeup_errors<_Base>;
+
         struct __stop_callback {
           __impl* __self_;
 
@@ -909,6 +1656,13 @@ namespace exec {
           return this->__base_.ready();
         }
 
+        // Releases the resources of a successful result that is not delivered.
+        void discard(const ::io_uring_cqe& __cqe) noexcept {
+          if constexpr (requires { this->__base_.discard(__cqe); }) {
+            this->__base_.discard(__cqe);
+          }
+        }
+
         void submit(::io_uring_sqe& __sqe) noexcept {
           [[maybe_unused]]
           int prev = __n_ops_.fetch_add(1, std::memory_order_relaxed);
@@ -929,6 +1683,9 @@ namespace exec {
             __context& __context_ = this->__base_.context();
             auto token = stdexec::get_stop_token(stdexec::get_env(__receiver));
             if (__cqe.res == -ECANCELED || __context_.stop_requested() || token.stop_requested()) {
+              if constexpr (requires { this->__base_.discard(__cqe); }) {
+                this->__base_.discard(__cqe);
+              }
               stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
             } else {
               this->__base_.complete(__cqe);
@@ -1075,122 +1832,1436 @@ namespace exec {
       using __t = __stoppable_task_facade_t<__impl>;
     };
 
-    class __scheduler {
-     public:
-      __context* __context_;
+    // Each io sender is parameterized by a small description of the io operation that fills in the
+    // submission queue entry. The description is stored in the operation state, so pointers into it
+    // stay valid until the operation completes.
+    template <class _Io>
+    concept __io_description = stdexec::__nothrow_move_constructible<_Io>
+                            && requires(_Io& __io, ::io_uring_sqe& __sqe) {
+                                 { __io.prepare(__sqe) } noexcept;
+                               };
+
+    // By default a successful io operation completes with the number of transferred bytes.
+    // A description can customize this by providing a `result(const io_uring_cqe&)` member.
+    template <__io_description _Io>
+    auto __io_result(_Io& __io, const ::io_uring_cqe& __cqe) noexcept {
+      if constexpr (requires { __io.result(__cqe); }) {
+        return __io.result(__cqe);
+      } else {
+        return static_cast<std::size_t>(__cqe.res);
+      }
+    }
 
-      auto operator==(const __scheduler&) const -> bool = default;
+    template <class _Io>
+    using __io_result_t = decltype(__io_uring::__io_result(
+      std::declval<_Io&>(),
+      std::declval<const ::io_uring_cqe&>()));
+
+    template <class _Io>
+    using __io_completion_signatures = stdexec::completion_signatures<
+      stdexec::__minvoke<
+        stdexec::__mremove<void, stdexec::__qf<stdexec::set_value_t>>,
+        __io_result_t<_Io>
+      >,
+      stdexec::set_error_t(std::error_code),
+      stdexec::set_stopped_t()
+    >;
+
+    // Reads up to __buffer_.size() bytes from __fd_ at the given offset.
+    // An offset of -1 reads from the current file position.
+    struct __read {
+      int __fd_;
+      std::span<std::byte> __buffer_;
+      ::off_t __offset_;
+#    ifndef STDEXEC_HAS_IORING_OP_READ
+      ::iovec __iov_{};
+#    endif
 
-      struct __schedule_env {
-        [[nodiscard]]
-        auto query(stdexec::get_completion_scheduler_t<stdexec::set_value_t>) const noexcept
-          -> __scheduler {
-          return __scheduler{__context_};
-        }
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+#    ifdef STDEXEC_HAS_IORING_OP_READ
+        __sqe.opcode = IORING_OP_READ;
+        __sqe.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe.len = static_cast<__u32>(__buffer_.size());
+#    else
+        __iov_ = ::iovec{.iov_base = __buffer_.data(), .iov_len = __buffer_.size()};
+        __sqe.opcode = IORING_OP_READV;
+        __sqe.addr = bit_cast<__u64>(&__iov_);
+        __sqe.len = 1;
+#    endif
+      }
+    };
 
-        __context* __context_;
-      };
+    // Writes up to __buffer_.size() bytes to __fd_ at the given offset.
+    // An offset of -1 writes at the current file position.
+    struct __write {
+      int __fd_;
+      std::span<const std::byte> __buffer_;
+      ::off_t __offset_;
+#    ifndef STDEXEC_HAS_IORING_OP_READ
+      ::iovec __iov_{};
+#    endif
 
-      class __schedule_sender {
-        using __completion_sigs =
-          stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_stopped_t()>;
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+#    ifdef STDEXEC_HAS_IORING_OP_READ
+        __sqe.opcode = IORING_OP_WRITE;
+        __sqe.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe.len = static_cast<__u32>(__buffer_.size());
+#    else
+        __iov_ = ::iovec{
+          .iov_base = const_cast<std::byte*>(__buffer_.data()), .iov_len = __buffer_.size()};
+        __sqe.opcode = IORING_OP_WRITEV;
+        __sqe.addr = bit_cast<__u64>(&__iov_);
+        __sqe.len = 1;
+#    endif
+      }
+    };
 
-        __schedule_env __env_;
+    // Scatter read into the given buffers. The iovec array is owned by the caller and must outlive
+    // the operation.
+    struct __readv {
+      int __fd_;
+      std::span<const ::iovec> __buffers_;
+      ::off_t __offset_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_READV;
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+        __sqe.addr = bit_cast<__u64>(__buffers_.data());
+        __sqe.len = static_cast<__u32>(__buffers_.size());
+      }
+    };
 
-       public:
-        using sender_concept = stdexec::sender_t;
-        using __id = __schedule_sender;
-        using __t = __schedule_sender;
+    // Gather write from the given buffers. The iovec array is owned by the caller and must outlive
+    // the operation.
+    struct __writev {
+      int __fd_;
+      std::span<const ::iovec> __buffers_;
+      ::off_t __offset_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_WRITEV;
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+        __sqe.addr = bit_cast<__u64>(__buffers_.data());
+        __sqe.len = static_cast<__u32>(__buffers_.size());
+      }
+    };
 
-        explicit __schedule_sender(__schedule_env __env) noexcept
-          : __env_{__env} {
-        }
+    // Reads into a registered buffer (IORING_OP_READ_FIXED).
+    struct __read_fixed {
+      int __fd_;
+      registered_buffer __buffer_;
+      ::off_t __offset_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_READ_FIXED;
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+        __sqe.addr = bit_cast<__u64>(__buffer_.data.data());
+        __sqe.len = static_cast<__u32>(__buffer_.data.size());
+        __sqe.buf_index = __buffer_.index;
+      }
+    };
 
-        [[nodiscard]]
-        auto get_env() const noexcept -> __schedule_env {
-          return __env_;
-        }
+    // Writes from a registered buffer (IORING_OP_WRITE_FIXED).
+    struct __write_fixed {
+      int __fd_;
+      registered_buffer __buffer_;
+      ::off_t __offset_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_WRITE_FIXED;
+        __sqe.fd = __fd_;
+        __sqe.off = static_cast<__u64>(__offset_);
+        __sqe.addr = bit_cast<__u64>(__buffer_.data.data());
+        __sqe.len = static_cast<__u32>(__buffer_.data.size());
+        __sqe.buf_index = __buffer_.index;
+      }
+    };
 
-        [[nodiscard]]
-        auto get_completion_signatures(stdexec::__ignore = {}) const noexcept -> __completion_sigs {
-          return {};
-        }
+    // Flushes the file to disk. Pass IORING_FSYNC_DATASYNC for fdatasync semantics.
+    struct __fsync {
+      int __fd_;
+      unsigned __flags_;
 
-        template <stdexec::receiver_of<__completion_sigs> _Receiver>
-        auto connect(_Receiver __receiver)
-          const & -> stdexec::__t<__schedule_operation<stdexec::__id<_Receiver>>> {
-          return stdexec::__t<__schedule_operation<stdexec::__id<_Receiver>>>(
-            std::in_place, *__env_.__context_, static_cast<_Receiver&&>(__receiver));
-        }
-      };
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_FSYNC;
+        __sqe.fd = __fd_;
+        __sqe.fsync_flags = __flags_;
+      }
 
-      class __schedule_after_sender {
-        using __completion_sigs = stdexec::completion_signatures<
-          stdexec::set_value_t(),
-          stdexec::set_error_t(std::exception_ptr),
-          stdexec::set_stopped_t()
-        >;
+      static void result(const ::io_uring_cqe&) noexcept {
+      }
+    };
 
-       public:
-        using sender_concept = stdexec::sender_t;
-        using __id = __schedule_after_sender;
-        using __t = __schedule_after_sender;
+    // Interprets the file descriptor of the wrapped description as an index into the registered
+    // file table.
+    template <__io_description _Io>
+    struct __fixed_file : _Io {
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        _Io::prepare(__sqe);
+        __sqe.flags |= IOSQE_FIXED_FILE;
+      }
+    };
 
-        __schedule_env __env_;
-        std::chrono::nanoseconds __duration_;
+#    ifdef STDEXEC_HAS_IORING_SOCKET_OPS
+    // Accepts a connection on the listening socket __fd_. The peer address is written to
+    // __addr_/__addrlen_ if they are non-null; both are owned by the caller.
+    struct __accept {
+      int __fd_;
+      ::sockaddr* __addr_;
+      ::socklen_t* __addrlen_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_ACCEPT;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(__addr_);
+        __sqe.addr2 = bit_cast<__u64>(__addrlen_);
+        __sqe.accept_flags = static_cast<__u32>(__flags_);
+      }
 
-        [[nodiscard]]
-        auto get_env() const noexcept -> __schedule_env {
-          return __env_;
-        }
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> safe_file_descriptor {
+        return safe_file_descriptor{__cqe.res};
+      }
+    };
 
-        template <class... _Env>
-        static auto get_completion_signatures(const __schedule_after_sender&, _Env&&...) noexcept
-          -> __completion_sigs {
-          return {};
-        }
+    // Connects __fd_ to the given address. The address is copied into the operation state.
+    struct __connect {
+      int __fd_;
+      ::sockaddr_storage __addr_;
+      ::socklen_t __addrlen_;
+
+      __connect(int __fd, const ::sockaddr* __addr, ::socklen_t __addrlen) noexcept
+        : __fd_{__fd}
+        , __addr_{}
+        , __addrlen_{std::min<::socklen_t>(__addrlen, sizeof(::sockaddr_storage))} {
+        std::memcpy(&__addr_, __addr, __addrlen_);
+      }
 
-        template <stdexec::receiver_of<__completion_sigs> _Receiver>
-        auto connect(_Receiver __receiver)
-          const & -> stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>> {
-          return stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>>(
-            std::in_place, *__env_.__context_, __duration_, static_cast<_Receiver&&>(__receiver));
-        }
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_CONNECT;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(&__addr_);
+        __sqe.off = __addrlen_;
+      }
+
+      static void result(const ::io_uring_cqe&) noexcept {
+      }
+    };
+
+    struct __send {
+      int __fd_;
+      std::span<const std::byte> __buffer_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_SEND;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe.len = static_cast<__u32>(__buffer_.size());
+        __sqe.msg_flags = static_cast<__u32>(__flags_);
+      }
+    };
+
+    struct __recv {
+      int __fd_;
+      std::span<std::byte> __buffer_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_RECV;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe.len = static_cast<__u32>(__buffer_.size());
+        __sqe.msg_flags = static_cast<__u32>(__flags_);
+      }
+    };
+
+    // The message header and everything it points to are owned by the caller.
+    struct __sendmsg {
+      int __fd_;
+      const ::msghdr* __msg_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_SENDMSG;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(__msg_);
+        __sqe.len = 1;
+        __sqe.msg_flags = static_cast<__u32>(__flags_);
+      }
+    };
+
+    // The message header and everything it points to are owned by the caller.
+    struct __recvmsg {
+      int __fd_;
+      ::msghdr* __msg_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_RECVMSG;
+        __sqe.fd = __fd_;
+        __sqe.addr = bit_cast<__u64>(__msg_);
+        __sqe.len = 1;
+        __sqe.msg_flags = static_cast<__u32>(__flags_);
+      }
+    };
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_MULTISHOT
+    // A multishot description arms one submission that produces an item for every completion
+    // carrying a result. Descriptions return true from end() for results that end the sequence.
+    template <class _Io>
+    concept __multishot_description =
+      __io_description<_Io> && requires(_Io& __io, const ::io_uring_cqe& __cqe) {
+        { __io.item(__cqe) };
+        { __io.end(__cqe) } noexcept -> std::same_as<bool>;
       };
 
-      [[nodiscard]]
-      auto schedule() const -> __schedule_sender {
-        return __schedule_sender{__schedule_env{__context_}};
+    struct __accept_multishot {
+      int __fd_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_ACCEPT;
+        __sqe.fd = __fd_;
+        __sqe.ioprio = IORING_ACCEPT_MULTISHOT;
+        __sqe.accept_flags = static_cast<__u32>(__flags_);
       }
 
-      [[nodiscard]]
-      auto now() const noexcept -> std::chrono::time_point<std::chrono::steady_clock> {
-        return std::chrono::steady_clock::now();
+      static auto item(const ::io_uring_cqe& __cqe) noexcept -> safe_file_descriptor {
+        return safe_file_descriptor{__cqe.res};
       }
 
-      [[nodiscard]]
-      auto schedule_after(std::chrono::nanoseconds __duration) const -> __schedule_after_sender {
-        return __schedule_after_sender{.__env_ = {__context_}, .__duration_ = __duration};
+      static auto end(const ::io_uring_cqe&) noexcept -> bool {
+        return false;
       }
+    };
 
-      template <class _Clock, class _Duration>
-      [[nodiscard]]
-      auto schedule_at(const std::chrono::time_point<_Clock, _Duration>& __time_point) const
-        -> __schedule_after_sender {
-        auto __duration = __time_point - _Clock::now();
-        return __schedule_after_sender{.__env_ = {__context_}, .__duration_ = __duration};
+#      ifdef STDEXEC_HAS_IORING_RECV_MULTISHOT
+    struct __recv_multishot {
+      int __fd_;
+      __buffer_ring* __ring_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) const noexcept {
+        __sqe.opcode = IORING_OP_RECV;
+        __sqe.fd = __fd_;
+        __sqe.ioprio = IORING_RECV_MULTISHOT;
+        __sqe.flags = IOSQE_BUFFER_SELECT;
+        __sqe.buf_group = __ring_->group_id();
+        __sqe.msg_flags = static_cast<__u32>(__flags_);
+      }
+
+      auto item(const ::io_uring_cqe& __cqe) const noexcept -> __provided_buffer {
+        if (!(__cqe.flags & IORING_CQE_F_BUFFER)) {
+          return __provided_buffer{};
+        }
+        return __provided_buffer{
+          *__ring_,
+          static_cast<__u16>(__cqe.flags >> IORING_CQE_BUFFER_SHIFT),
+          static_cast<std::size_t>(__cqe.res)};
+      }
+
+      // A receive of zero bytes signals an orderly shutdown of the peer.
+      static auto end(const ::io_uring_cqe& __cqe) noexcept -> bool {
+        return __cqe.res == 0;
       }
     };
+#      endif
 
-    inline auto __context::get_scheduler() noexcept -> __scheduler {
-      return __scheduler{this};
-    }
-  } // namespace __io_uring
+    template <class _Io>
+    using __multishot_item_t =
+      decltype(std::declval<_Io&>().item(std::declval<const ::io_uring_cqe&>()));
 
-  using __io_uring::until;
-  using io_uring_context = __io_uring::__context;
+    template <class _Io>
+    using __multishot_item_sender_t =
+      stdexec::__call_result_t<stdexec::just_t, __multishot_item_t<_Io>>;
+
+    template <class _Io, class _ReceiverId>
+    struct __multishot_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using __item_sender_t = __multishot_item_sender_t<_Io>;
+
+      class __t;
+
+      struct __item_operation;
+
+      struct __next_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __t* __op_;
+        __item_operation* __item_;
+
+        void set_value() noexcept {
+          __op_->__item_done(__item_, false);
+        }
+
+        void set_stopped() noexcept {
+          __op_->__item_done(__item_, true);
+        }
+
+        auto get_env() const noexcept -> stdexec::env_of_t<_Receiver> {
+          return stdexec::get_env(__op_->__rcvr_);
+        }
+      };
+
+      // Every item is connected and started in its own operation, because the kernel may produce
+      // the next completion before the previous item has been processed. The storage of finished
+      // items is kept on a free list of the multishot operation and reused for later items.
+      struct __item_operation {
+        stdexec::connect_result_t<next_sender_of_t<_Receiver, __item_sender_t>, __next_receiver>
+          __op_;
+
+        __item_operation(__t* __op, __multishot_item_t<_Io>&& __item)
+          : __op_{stdexec::connect(
+              exec::set_next(__op->__rcvr_, stdexec::just(static_cast<decltype(__item)&&>(__item))),
+              __next_receiver{__op, this})} {
+        }
+      };
+
+      // The storage of a finished item while it waits on the free list.
+      struct __free_item {
+        __free_item* __next_;
+      };
+
+      // Cancels the armed submission with IORING_OP_ASYNC_CANCEL.
+      struct __cancel_operation : __task {
+        __t* __op_;
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__cancel_operation*>(__pointer);
+          __sqe = ::io_uring_sqe{};
+          __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+          __sqe.addr = bit_cast<__u64>(static_cast<__task*>(__self->__op_));
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+          static_cast<__cancel_operation*>(__pointer)->__op_->__release();
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        explicit __cancel_operation(__t* __op) noexcept
+          : __task{__vtable}
+          , __op_{__op} {
+        }
+      };
+
+      class __t : public __task {
+       public:
+        using __id = __multishot_operation;
+
+        __t(__context& __context, _Io __io, _Receiver&& __rcvr)
+          noexcept(stdexec::__nothrow_move_constructible<_Receiver>)
+          : __task{__vtable}
+          , __context_{__context}
+          , __io_{static_cast<_Io&&>(__io)}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+          , __item_alloc_{__make_item_allocator(__rcvr_)}
+          , __cancel_operation_{this} {
+        }
+
+        void start() & noexcept {
+          __n_refs_.store(1, std::memory_order_relaxed);
+          __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
+          __on_receiver_stop_
+            .emplace(stdexec::get_stop_token(stdexec::get_env(__rcvr_)), __stop_callback{this});
+          __arm();
+        }
+
+       private:
+        friend struct __next_receiver;
+        friend struct __item_operation;
+        friend struct __cancel_operation;
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&
+        >::template callback_type<__stop_callback>>;
+
+        // Items are allocated with the allocator of the receiver's environment, if it has one.
+        static auto __make_item_allocator(const _Receiver& __rcvr) noexcept {
+          using __env_t = stdexec::env_of_t<_Receiver>;
+          if constexpr (stdexec::__callable<stdexec::get_allocator_t, __env_t>) {
+            using __alloc_t = stdexec::__rebind_alloc_t<
+              __item_operation,
+              stdexec::__decay_t<stdexec::__call_result_t<stdexec::get_allocator_t, __env_t>>
+            >;
+            return __alloc_t{stdexec::get_allocator(stdexec::get_env(__rcvr))};
+          } else {
+            return std::allocator<__item_operation>{};
+          }
+        }
+
+        using __item_allocator_t =
+          decltype(__make_item_allocator(std::declval<const _Receiver&>()));
+        using __item_traits = std::allocator_traits<__item_allocator_t>;
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__t*>(__pointer);
+          __sqe = ::io_uring_sqe{};
+          if (__self->__stop_requested_.load(std::memory_order_acquire)) {
+            // A cancellation may have been processed before this submission. Submit a no-op
+            // instead, its completion ends the sequence.
+            __sqe.opcode = IORING_OP_NOP;
+            __self->__submitted_nop_ = true;
+          } else {
+            __self->__io_.prepare(__sqe);
+          }
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          static_cast<__t*>(__pointer)->__complete(__cqe);
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        void __arm() noexcept {
+          __submit(this);
+        }
+
+        void __submit(__task* __task) noexcept {
+          if (auto __ec = __context_.__submit_and_wakeup(__task)) {
+            __fail(__ec);
+          }
+        }
+
+        // The context could not be woken up for a submission. The submission is still pending,
+        // so the sequence ends with the error once the context picks it up.
+        void __fail(std::error_code __ec) noexcept {
+          __n_refs_.fetch_add(1, std::memory_order_relaxed);
+          int __expected = 0;
+          __wakeup_errno_.compare_exchange_strong(
+            __expected, __ec.value(), std::memory_order_relaxed, std::memory_order_relaxed);
+          __request_stop();
+          __release();
+        }
+
+        void __complete(const ::io_uring_cqe& __cqe) noexcept {
+          if (std::exchange(__submitted_nop_, false)) {
+            __finish(-ECANCELED);
+            return;
+          }
+          const bool __is_last = !(__cqe.flags & IORING_CQE_F_MORE);
+          if (__cqe.res >= 0 && !__io_.end(__cqe)) {
+            if (__stop_requested_.load(std::memory_order_acquire)) {
+              // Release the resources of results that arrive after a stop request.
+              (void) __io_.item(__cqe);
+            } else {
+              __emit(__cqe);
+            }
+            if (__is_last) {
+              if (__stop_requested_.load(std::memory_order_acquire)) {
+                __finish(-ECANCELED);
+              } else {
+                // The kernel may terminate a multishot request at any time, e.g. on a completion
+                // queue overflow. Arm it again.
+                __arm();
+              }
+            }
+          } else {
+            if (__cqe.res >= 0) {
+              (void) __io_.item(__cqe);
+            }
+            if (__is_last) {
+              __finish(__cqe.res);
+            }
+          }
+        }
+
+        void __finish(int __result) noexcept {
+          __result_ = __result;
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+          __release();
+        }
+
+        void __emit(const ::io_uring_cqe& __cqe) noexcept {
+          __n_refs_.fetch_add(1, std::memory_order_relaxed);
+          STDEXEC_TRY {
+            void* __storage = __take_item_storage();
+            stdexec::__scope_guard __guard{[&]() noexcept { __put_item_storage(__storage); }};
+            auto* __item = ::new (__storage) __item_operation{this, __io_.item(__cqe)};
+            __guard.__dismiss();
+            stdexec::start(__item->__op_);
+          }
+          STDEXEC_CATCH_ALL {
+            if (!__exception_) {
+              __exception_ = std::current_exception();
+            }
+            __request_stop();
+            __release();
+          }
+        }
+
+        // Reuses the storage of a finished item, or allocates new storage. Only the thread that
+        // drives the context calls this.
+        auto __take_item_storage() -> void* {
+          if (__spare_items_ == nullptr) {
+            __spare_items_ = __finished_items_.exchange(nullptr, std::memory_order_acquire);
+          }
+          if (__free_item* __free = __spare_items_) {
+            __spare_items_ = __free->__next_;
+            return __free;
+          }
+          return __item_traits::allocate(__item_alloc_, 1);
+        }
+
+        // Items may finish on any thread, so their storage goes to a lock-free stack that
+        // __take_item_storage takes as a whole.
+        void __put_item_storage(void* __storage) noexcept {
+          static_assert(sizeof(__item_operation) >= sizeof(__free_item));
+          static_assert(alignof(__item_operation) >= alignof(__free_item));
+          auto* __free = ::new (__storage)
+            __free_item{__finished_items_.load(std::memory_order_relaxed)};
+          while (!__finished_items_.compare_exchange_weak(
+            __free->__next_, __free, std::memory_order_release, std::memory_order_relaxed)) {
+          }
+        }
+
+        void __deallocate_items(__free_item* __list) noexcept {
+          while (__list != nullptr) {
+            __free_item* __next = __list->__next_;
+            __item_traits::deallocate(
+              __item_alloc_, static_cast<__item_operation*>(static_cast<void*>(__list)), 1);
+            __list = __next;
+          }
+        }
+
+        void __item_done(__item_operation* __item, bool __stopped) noexcept {
+          __item->~__item_operation();
+          __put_item_storage(__item);
+          if (__stopped) {
+            __request_stop();
+          }
+          __release();
+        }
+
+        void __request_stop() noexcept {
+          if (!__stop_requested_.exchange(true, std::memory_order_acq_rel)) {
+            __n_refs_.fetch_add(1, std::memory_order_relaxed);
+            __submit(&__cancel_operation_);
+          }
+        }
+
+        void __release() noexcept {
+          if (__n_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // No item is in flight anymore.
+            __deallocate_items(std::exchange(__spare_items_, nullptr));
+            __deallocate_items(__finished_items_.exchange(nullptr, std::memory_order_acquire));
+            const int __wakeup_errno = __wakeup_errno_.load(std::memory_order_relaxed);
+            if (__exception_) {
+              stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::move(__exception_));
+            } else if (__wakeup_errno != 0) {
+              stdexec::set_error(
+                static_cast<_Receiver&&>(__rcvr_),
+                std::error_code(__wakeup_errno, std::system_category()));
+            } else if (__result_ < 0 && __result_ != -ECANCELED) {
+              stdexec::set_error(
+                static_cast<_Receiver&&>(__rcvr_),
+                std::error_code(-__result_, std::system_category()));
+            } else if (__context_.stop_requested()) {
+              stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+            } else {
+              exec::__set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+            }
+          }
+        }
+
+        __context& __context_;
+        _Io __io_;
+        _Receiver __rcvr_;
+        __item_allocator_t __item_alloc_;
+        __cancel_operation __cancel_operation_;
+        std::atomic<int> __n_refs_{0};
+        std::atomic<bool> __stop_requested_{false};
+        std::atomic<int> __wakeup_errno_{0};
+        int __result_{0};
+        bool __submitted_nop_{false};
+        __free_item* __spare_items_{nullptr};
+        std::atomic<__free_item*> __finished_items_{nullptr};
+        std::exception_ptr __exception_{};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+      };
+    };
+#    endif
+
+    template <class _ReceiverId, __io_description _Io>
+    struct __io_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        _Io __io_;
+
+       public:
+        static constexpr bool __completes_with_error_code = true;
+
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          __sqe = ::io_uring_sqe{};
+          __io_.prepare(__sqe);
+        }
+
+        // Called instead of complete() if the operation succeeded after a stop request.
+        // Results that own resources, such as accepted sockets, are released here.
+        void discard(const ::io_uring_cqe& __cqe) noexcept {
+          if (__cqe.res >= 0) {
+            (void) __io_uring::__io_result(__io_, __cqe);
+          }
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          if (__cqe.res >= 0) {
+            if constexpr (std::is_void_v<__io_result_t<_Io>>) {
+              __io_uring::__io_result(__io_, __cqe);
+              stdexec::set_value(static_cast<_Receiver&&>(this->__receiver_));
+            } else {
+              stdexec::set_value(
+                static_cast<_Receiver&&>(this->__receiver_),
+                __io_uring::__io_result(__io_, __cqe));
+            }
+          } else {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(this->__receiver_),
+              std::error_code(-__cqe.res, std::system_category()));
+          }
+        }
+
+        __impl(__context& __context, _Io __io, _Receiver&& __receiver)
+          noexcept(stdexec::__nothrow_move_constructible<_Receiver>)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __io_{static_cast<_Io&&>(__io)} {
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+
+    template <class... _Ios>
+    using __linked_completion_signatures = stdexec::completion_signatures<
+      stdexec::__minvoke<
+        stdexec::__mremove<void, stdexec::__qf<stdexec::set_value_t>>,
+        __io_result_t<_Ios>...
+      >,
+      stdexec::set_error_t(std::error_code),
+      stdexec::set_stopped_t()
+    >;
+
+    // Submits the io descriptions as one chain of linked submission queue entries
+    // (IOSQE_IO_LINK). The kernel starts each step after its predecessor succeeded and cancels the
+    // remaining steps after a failure, which includes a short read or write.
+    template <class _ReceiverId, __io_description... _Ios>
+    struct __linked_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      static constexpr std::size_t __n_steps = sizeof...(_Ios);
+
+      class __t;
+
+      struct __step : __task {
+        __t* __op_{nullptr};
+        std::size_t __index_{0};
+        ::io_uring_cqe __cqe_{};
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__step*>(__pointer);
+          __self->__op_->__submit(__self->__index_, __sqe);
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto* __self = static_cast<__step*>(__pointer);
+          __self->__cqe_ = __cqe;
+          __self->__op_->__release();
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        __step() noexcept
+          : __task{__vtable} {
+        }
+      };
+
+      struct __cancel : __task {
+        __step* __target_{nullptr};
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto* __self = static_cast<__cancel*>(__pointer);
+          __sqe = ::io_uring_sqe{};
+          __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+          __sqe.addr = bit_cast<__u64>(static_cast<__task*>(__self->__target_));
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+          static_cast<__cancel*>(__pointer)->__target_->__op_->__release();
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        __cancel() noexcept
+          : __task{__vtable} {
+        }
+      };
+
+      class __t : stdexec::__immovable {
+        friend struct __step;
+        friend struct __cancel;
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&
+        >::template callback_type<__stop_callback>>;
+
+        __context& __context_;
+        std::tuple<_Ios...> __ios_;
+        _Receiver __receiver_;
+        std::array<__step, __n_steps> __steps_{};
+        std::array<__cancel, __n_steps> __cancels_{};
+        std::atomic<std::size_t> __n_refs_{0};
+        std::atomic<bool> __stop_requested_{false};
+        std::atomic<int> __wakeup_errno_{0};
+        bool __is_armed_{false};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+
+        template <class _Fn>
+        void __visit(std::size_t __index, _Fn __fn) noexcept {
+          [&]<std::size_t... _Is>(std::index_sequence<_Is...>) {
+            ((__index == _Is ? __fn(std::get<_Is>(__ios_)) : void()), ...);
+          }(std::make_index_sequence<__n_steps>{});
+        }
+
+        void __submit(std::size_t __index, ::io_uring_sqe& __sqe) noexcept {
+          // The stop callbacks are installed once the chain is handed to the kernel, see
+          // __stoppable_task_facade.
+          if (!std::exchange(__is_armed_, true)) {
+            __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
+            __on_receiver_stop_.emplace(
+              stdexec::get_stop_token(stdexec::get_env(__receiver_)), __stop_callback{this});
+          }
+          __sqe = ::io_uring_sqe{};
+          __visit(__index, [&](auto& __io) noexcept { __io.prepare(__sqe); });
+          if (__index + 1 < __n_steps) {
+            __sqe.flags |= IOSQE_IO_LINK;
+          }
+        }
+
+        void __request_stop() noexcept {
+          if (__stop_requested_.exchange(true, std::memory_order_relaxed)) {
+            return;
+          }
+          // The chain may complete concurrently. Only cancel its steps if it is still in flight.
+          // The extra reference keeps the chain alive until a failed wakeup is recorded.
+          std::size_t __n = __n_refs_.load(std::memory_order_relaxed);
+          do {
+            if (__n == 0) {
+              return;
+            }
+          } while (!__n_refs_.compare_exchange_weak(
+            __n, __n + __n_steps + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+          __task_queue __cancels{};
+          for (__cancel& __op: __cancels_) {
+            __cancels.push_back(&__op);
+          }
+          if (auto __ec = __context_.__submit_and_wakeup(static_cast<__task_queue&&>(__cancels))) {
+            __fail(__ec);
+          }
+          __release();
+        }
+
+        // The context could not be woken up for a submission. The submitted tasks are still
+        // pending and complete once the context picks them up, then the chain completes with the
+        // error.
+        void __fail(std::error_code __ec) noexcept {
+          int __expected = 0;
+          __wakeup_errno_.compare_exchange_strong(
+            __expected, __ec.value(), std::memory_order_relaxed, std::memory_order_relaxed);
+        }
+
+        void __release() noexcept {
+          if (__n_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            __on_context_stop_.reset();
+            __on_receiver_stop_.reset();
+            __complete();
+          }
+        }
+
+        template <class _Io>
+        static auto __result_tuple(_Io& __io, const ::io_uring_cqe& __cqe) noexcept {
+          if constexpr (std::is_void_v<__io_result_t<_Io>>) {
+            __io_uring::__io_result(__io, __cqe);
+            return std::tuple<>{};
+          } else {
+            return std::tuple<__io_result_t<_Io>>{__io_uring::__io_result(__io, __cqe)};
+          }
+        }
+
+        // Releases the resources of the steps that succeeded before the chain broke.
+        void __release_results(std::size_t __n_succeeded) noexcept {
+          for (std::size_t __i = 0; __i < __n_succeeded; ++__i) {
+            __visit(__i, [&](auto& __io) noexcept {
+              (void) __io_uring::__io_result(__io, __steps_[__i].__cqe_);
+            });
+          }
+        }
+
+        void __complete() noexcept {
+          std::size_t __failed = 0;
+          while (__failed < __n_steps && __steps_[__failed].__cqe_.res >= 0) {
+            ++__failed;
+          }
+          const int __wakeup_errno = __wakeup_errno_.load(std::memory_order_relaxed);
+          if (__wakeup_errno != 0) {
+            __release_results(__failed);
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::error_code(__wakeup_errno, std::system_category()));
+            return;
+          }
+          if (__failed == __n_steps) {
+            auto __results = [&]<std::size_t... _Is>(std::index_sequence<_Is...>) {
+              return std::tuple_cat(__result_tuple(std::get<_Is>(__ios_), __steps_[_Is].__cqe_)...);
+            }(std::make_index_sequence<__n_steps>{});
+            std::apply(
+              [&](auto&&... __values) noexcept {
+                stdexec::set_value(
+                  static_cast<_Receiver&&>(__receiver_),
+                  static_cast<decltype(__values)&&>(__values)...);
+              },
+              static_cast<decltype(__results)&&>(__results));
+            return;
+          }
+          __release_results(__failed);
+          const int __res = __steps_[__failed].__cqe_.res;
+          if (
+            __res == -ECANCELED
+            && (__stop_requested_.load(std::memory_order_relaxed) || __context_.stop_requested())) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__receiver_));
+          } else {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::error_code(-__res, std::system_category()));
+          }
+        }
+
+       public:
+        using __id = __linked_operation;
+
+        __t(__context& __context, std::tuple<_Ios...> __ios, _Receiver&& __receiver)
+          noexcept(stdexec::__nothrow_move_constructible<_Receiver>)
+          : __context_{__context}
+          , __ios_{static_cast<std::tuple<_Ios...>&&>(__ios)}
+          , __receiver_{static_cast<_Receiver&&>(__receiver)} {
+          for (std::size_t __i = 0; __i < __n_steps; ++__i) {
+            __steps_[__i].__op_ = this;
+            __steps_[__i].__index_ = __i;
+            __cancels_[__i].__target_ = &__steps_[__i];
+          }
+        }
+
+        void start() & noexcept {
+          // One more reference than there are steps, so that a failed wakeup can be recorded
+          // before the chain completes.
+          if (__n_steps > __context_.__max_chain_length()) {
+            // The chain would be put back on the pending queue forever, see io_uring_link.
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__receiver_),
+              std::error_code(EINVAL, std::system_category()));
+            return;
+          }
+          __n_refs_.store(__n_steps + 1, std::memory_order_relaxed);
+          __task_queue __chain{};
+          for (__step& __op: __steps_) {
+            __chain.push_back(&__op);
+          }
+          if (auto __ec = __context_.__submit_and_wakeup(static_cast<__task_queue&&>(__chain))) {
+            __fail(__ec);
+          }
+          __release();
+        }
+      };
+    };
+
+    struct __link_t;
+
+    class __scheduler {
+     public:
+      __context* __context_;
+
+      auto operator==(const __scheduler&) const -> bool = default;
+
+      struct __schedule_env {
+        [[nodiscard]]
+        auto query(stdexec::get_completion_scheduler_t<stdexec::set_value_t>) const noexcept
+          -> __scheduler {
+          return __scheduler{__context_};
+        }
+
+        __context* __context_;
+      };
+
+      class __schedule_sender {
+        using __completion_sigs =
+          stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_stopped_t()>;
+
+        __schedule_env __env_;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __schedule_sender;
+        using __t = __schedule_sender;
+
+        explicit __schedule_sender(__schedule_env __env) noexcept
+          : __env_{__env} {
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        [[nodiscard]]
+        auto get_completion_signatures(stdexec::__ignore = {}) const noexcept -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver)
+          const & -> stdexec::__t<__schedule_operation<stdexec::__id<_Receiver>>> {
+          return stdexec::__t<__schedule_operation<stdexec::__id<_Receiver>>>(
+            std::in_place, *__env_.__context_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+      class __schedule_after_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()
+        >;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __schedule_after_sender;
+        using __t = __schedule_after_sender;
+
+        __schedule_env __env_;
+        std::chrono::nanoseconds __duration_;
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __schedule_after_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver)
+          const & -> stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>> {
+          return stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>>(
+            std::in_place, *__env_.__context_, __duration_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+      template <__io_description _Io>
+      class __io_sender {
+        using __completion_sigs = __io_completion_signatures<_Io>;
+
+        __schedule_env __env_;
+        _Io __io_;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __io_sender;
+        using __t = __io_sender;
+
+        explicit __io_sender(__schedule_env __env, _Io __io) noexcept
+          : __env_{__env}
+          , __io_{static_cast<_Io&&>(__io)} {
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        [[nodiscard]]
+        auto get_completion_signatures(stdexec::__ignore = {}) const noexcept -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver)
+          const & -> stdexec::__t<__io_operation<stdexec::__id<_Receiver>, _Io>> {
+          return stdexec::__t<__io_operation<stdexec::__id<_Receiver>, _Io>>(
+            std::in_place, *__env_.__context_, __io_, static_cast<_Receiver&&>(__receiver));
+        }
+
+        [[nodiscard]]
+        auto __with_fixed_file() const noexcept -> __io_sender<__fixed_file<_Io>> {
+          return __io_sender<__fixed_file<_Io>>{__env_, __fixed_file<_Io>{__io_}};
+        }
+
+       private:
+        friend struct __link_t;
+      };
+
+      template <__io_description... _Ios>
+      class __linked_sender {
+        using __completion_sigs = __linked_completion_signatures<_Ios...>;
+
+        __schedule_env __env_;
+        std::tuple<_Ios...> __ios_;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __linked_sender;
+        using __t = __linked_sender;
+
+        explicit __linked_sender(__schedule_env __env, _Ios... __ios) noexcept
+          : __env_{__env}
+          , __ios_{static_cast<_Ios&&>(__ios)...} {
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        [[nodiscard]]
+        auto get_completion_signatures(stdexec::__ignore = {}) const noexcept -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver)
+          const & -> stdexec::__t<__linked_operation<stdexec::__id<_Receiver>, _Ios...>> {
+          return stdexec::__t<__linked_operation<stdexec::__id<_Receiver>, _Ios...>>(
+            *__env_.__context_, __ios_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+#    ifdef STDEXEC_HAS_IORING_MULTISHOT
+      template <__multishot_description _Io>
+      class __multishot_sender {
+        __schedule_env __env_;
+        _Io __io_;
+
+       public:
+        using sender_concept = exec::sequence_sender_t;
+        using __id = __multishot_sender;
+        using __t = __multishot_sender;
+        using completion_signatures = stdexec::completion_signatures<
+          stdexec::set_value_t(),
+          stdexec::set_error_t(std::error_code),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()
+        >;
+        using item_types = exec::item_types<__multishot_item_sender_t<_Io>>;
+
+        explicit __multishot_sender(__schedule_env __env, _Io __io) noexcept
+          : __env_{__env}
+          , __io_{static_cast<_Io&&>(__io)} {
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <exec::sequence_receiver_of<item_types> _Receiver>
+        auto subscribe(_Receiver __rcvr) const & noexcept(
+          stdexec::__nothrow_move_constructible<_Receiver>)
+          -> stdexec::__t<__multishot_operation<_Io, stdexec::__id<_Receiver>>> {
+          return {*__env_.__context_, __io_, static_cast<_Receiver&&>(__rcvr)};
+        }
+      };
+#    endif
+
+      [[nodiscard]]
+      auto schedule() const -> __schedule_sender {
+        return __schedule_sender{__schedule_env{__context_}};
+      }
+
+      [[nodiscard]]
+      auto now() const noexcept -> std::chrono::time_point<std::chrono::steady_clock> {
+        return std::chrono::steady_clock::now();
+      }
+
+      [[nodiscard]]
+      auto schedule_after(std::chrono::nanoseconds __duration) const -> __schedule_after_sender {
+        return __schedule_after_sender{.__env_ = {__context_}, .__duration_ = __duration};
+      }
+
+      template <class _Clock, class _Duration>
+      [[nodiscard]]
+      auto schedule_at(const std::chrono::time_point<_Clock, _Duration>& __time_point) const
+        -> __schedule_after_sender {
+        auto __duration = __time_point - _Clock::now();
+        return __schedule_after_sender{.__env_ = {__context_}, .__duration_ = __duration};
+      }
+
+      /// @brief Reads into @p __buffer from @p __fd at @p __offset.
+      ///
+      /// The sender completes with the number of bytes read, which is 0 at end of file.
+      /// An offset of -1 reads from the current file position.
+      [[nodiscard]]
+      auto async_read_some(int __fd, std::span<std::byte> __buffer, ::off_t __offset = -1) const
+        -> __io_sender<__read> {
+        return __io_sender<__read>{__schedule_env{__context_}, __read{__fd, __buffer, __offset}};
+      }
+
+      /// @brief Reads into the buffers described by @p __buffers (IORING_OP_READV).
+      ///
+      /// The iovec array must stay alive until the sender completes.
+      [[nodiscard]]
+      auto async_read_some(int __fd, std::span<const ::iovec> __buffers, ::off_t __offset = -1)
+        const -> __io_sender<__readv> {
+        return __io_sender<__readv>{
+          __schedule_env{__context_}, __readv{__fd, __buffers, __offset}};
+      }
+
+      /// @brief Writes @p __buffer to @p __fd at @p __offset.
+      ///
+      /// The sender completes with the number of bytes written.
+      /// An offset of -1 writes at the current file position.
+      [[nodiscard]]
+      auto async_write_some(int __fd, std::span<const std::byte> __buffer, ::off_t __offset = -1)
+        const -> __io_sender<__write> {
+        return __io_sender<__write>{
+          __schedule_env{__context_}, __write{__fd, __buffer, __offset}};
+      }
+
+      /// @brief Writes the buffers described by @p __buffers (IORING_OP_WRITEV).
+      ///
+      /// The iovec array must stay alive until the sender completes.
+      [[nodiscard]]
+      auto async_write_some(int __fd, std::span<const ::iovec> __buffers, ::off_t __offset = -1)
+        const -> __io_sender<__writev> {
+        return __io_sender<__writev>{
+          __schedule_env{__context_}, __writev{__fd, __buffers, __offset}};
+      }
+
+      /// @brief Reads into a registered buffer using IORING_OP_READ_FIXED.
+      [[nodiscard]]
+      auto async_read_some(int __fd, registered_buffer __buffer, ::off_t __offset = -1) const
+        -> __io_sender<__read_fixed> {
+        return __io_sender<__read_fixed>{
+          __schedule_env{__context_}, __read_fixed{__fd, __buffer, __offset}};
+      }
+
+      /// @brief Writes from a registered buffer using IORING_OP_WRITE_FIXED.
+      [[nodiscard]]
+      auto async_write_some(int __fd, registered_buffer __buffer, ::off_t __offset = -1) const
+        -> __io_sender<__write_fixed> {
+        return __io_sender<__write_fixed>{
+          __schedule_env{__context_}, __write_fixed{__fd, __buffer, __offset}};
+      }
+
+      /// @brief Flushes the data and metadata of @p __fd to disk (IORING_OP_FSYNC).
+      ///
+      /// Pass IORING_FSYNC_DATASYNC in @p __flags to skip metadata that is not needed to read
+      /// the data back.
+      [[nodiscard]]
+      auto async_fsync(int __fd, unsigned __flags = 0) const -> __io_sender<__fsync> {
+        return __io_sender<__fsync>{__schedule_env{__context_}, __fsync{__fd, __flags}};
+      }
+
+      /// @brief Same as the overloads above, but @p __file refers to a registered file.
+      template <class _Buffer>
+      [[nodiscard]]
+      auto
+        async_read_some(registered_file __file, _Buffer&& __buffer, ::off_t __offset = -1) const {
+        return async_read_some(static_cast<int>(__file.index), __buffer, __offset)
+          .__with_fixed_file();
+      }
+
+      /// @brief Same as the overloads above, but @p __file refers to a registered file.
+      template <class _Buffer>
+      [[nodiscard]]
+      auto
+        async_write_some(registered_file __file, _Buffer&& __buffer, ::off_t __offset = -1) const {
+        return async_write_some(static_cast<int>(__file.index), __buffer, __offset)
+          .__with_fixed_file();
+      }
+
+#    ifdef STDEXEC_HAS_IORING_SOCKET_OPS
+      /// @brief Accepts a connection on the listening socket @p __fd.
+      ///
+      /// The sender completes with the connected socket. If @p __addr is non-null, the peer
+      /// address is stored there and @p __addrlen must stay alive until the sender completes.
+      [[nodiscard]]
+      auto async_accept(
+        int __fd,
+        ::sockaddr* __addr = nullptr,
+        ::socklen_t* __addrlen = nullptr,
+        int __flags = SOCK_CLOEXEC) const -> __io_sender<__accept> {
+        return __io_sender<__accept>{
+          __schedule_env{__context_}, __accept{__fd, __addr, __addrlen, __flags}};
+      }
+
+      /// @brief Connects the socket @p __fd to @p __addr.
+      [[nodiscard]]
+      auto async_connect(int __fd, const ::sockaddr* __addr, ::socklen_t __addrlen) const
+        -> __io_sender<__connect> {
+        return __io_sender<__connect>{
+          __schedule_env{__context_}, __connect{__fd, __addr, __addrlen}};
+      }
+
+      /// @brief Sends @p __buffer on the socket @p __fd.
+      ///
+      /// The sender completes with the number of bytes sent.
+      [[nodiscard]]
+      auto async_send(int __fd, std::span<const std::byte> __buffer, int __flags = 0) const
+        -> __io_sender<__send> {
+        return __io_sender<__send>{__schedule_env{__context_}, __send{__fd, __buffer, __flags}};
+      }
+
+      /// @brief Receives into @p __buffer from the socket @p __fd.
+      ///
+      /// The sender completes with the number of bytes received, which is 0 on an orderly shutdown.
+      [[nodiscard]]
+      auto async_recv(int __fd, std::span<std::byte> __buffer, int __flags = 0) const
+        -> __io_sender<__recv> {
+        return __io_sender<__recv>{__schedule_env{__context_}, __recv{__fd, __buffer, __flags}};
+      }
+
+      /// @brief Sends the message @p __msg on the socket @p __fd.
+      [[nodiscard]]
+      auto async_sendmsg(int __fd, const ::msghdr& __msg, int __flags = 0) const
+        -> __io_sender<__sendmsg> {
+        return __io_sender<__sendmsg>{
+          __schedule_env{__context_}, __sendmsg{__fd, &__msg, __flags}};
+      }
+
+      /// @brief Receives a message from the socket @p __fd into @p __msg.
+      [[nodiscard]]
+      auto async_recvmsg(int __fd, ::msghdr& __msg, int __flags = 0) const
+        -> __io_sender<__recvmsg> {
+        return __io_sender<__recvmsg>{
+          __schedule_env{__context_}, __recvmsg{__fd, &__msg, __flags}};
+      }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_MULTISHOT
+      /// @brief Accepts connections on the listening socket @p __fd with a single multishot
+      /// request (IORING_ACCEPT_MULTISHOT).
+      ///
+      /// The returned sequence sender produces one safe_file_descriptor per accepted connection
+      /// until it is stopped or an error occurs.
+      [[nodiscard]]
+      auto async_accept_multishot(int __fd, int __flags = SOCK_CLOEXEC) const
+        -> __multishot_sender<__accept_multishot> {
+        return __multishot_sender<__accept_multishot>{
+          __schedule_env{__context_}, __accept_multishot{__fd, __flags}};
+      }
+
+#      ifdef STDEXEC_HAS_IORING_RECV_MULTISHOT
+      /// @brief Receives from the socket @p __fd with a single multishot request
+      /// (IORING_RECV_MULTISHOT), letting the kernel pick buffers from @p __ring.
+      ///
+      /// The returned sequence sender produces one io_uring_provided_buffer per received message
+      /// and completes when the peer shuts down the connection. If the ring runs out of buffers,
+      /// the sequence completes with ENOBUFS.
+      [[nodiscard]]
+      auto async_recv_multishot(int __fd, __buffer_ring& __ring, int __flags = 0) const
+        -> __multishot_sender<__recv_multishot> {
+        return __multishot_sender<__recv_multishot>{
+          __schedule_env{__context_}, __recv_multishot{__fd, &__ring, __flags}};
+      }
+#      endif
+#    endif
+    };
+
+    inline auto __context::get_scheduler() noexcept -> __scheduler {
+      return __scheduler{this};
+    }
+
+    struct __link_t {
+      /// @brief Submits the given io senders as one chain of linked requests, e.g. a read followed
+      /// by a write and an fsync.
+      ///
+      /// All steps are submitted with a single io_uring_enter and the kernel starts each one after
+      /// its predecessor succeeded. The returned sender completes once with the results of all
+      /// steps. If a step fails, it completes with that step's error and the remaining steps are
+      /// cancelled; a short read or write breaks the chain with ECANCELED.
+      /// Throws std::invalid_argument if the chain has more steps than the ring of the context can
+      /// take at once, i.e. more than its submission queue entries or completion budget.
+      template <__io_description... _Ios>
+        requires(sizeof...(_Ios) != 0)
+      auto operator()(const __scheduler::__io_sender<_Ios>&... __steps) const
+        -> __scheduler::__linked_sender<_Ios...> {
+        __scheduler::__schedule_env __env = std::get<0>(std::tie(__steps.__env_...));
+        if (((__steps.__env_.__context_ != __env.__context_) || ...)) {
+          STDEXEC_THROW(std::invalid_argument(
+            "exec::io_uring_link: all senders must belong to the same io_uring_context"));
+        }
+        if (sizeof...(_Ios) > __env.__context_->__max_chain_length()) {
+          STDEXEC_THROW(std::invalid_argument(
+            "exec::io_uring_link: the chain is longer than the io_uring_context can submit"));
+        }
+        return __scheduler::__linked_sender<_Ios...>{__env, __steps.__io_...};
+      }
+    };
+  } // namespace __io_uring
+
+  using __io_uring::until;
+  using __io_uring::registered_file;
+  using __io_uring::registered_buffer;
+  using io_uring_context = __io_uring::__context;
+  using io_uring_options = __io_uring::__options;
+#    ifdef STDEXEC_HAS_IORING_MULTISHOT
+  using io_uring_buffer_ring = __io_uring::__buffer_ring;
+  using io_uring_provided_buffer = __io_uring::__provided_buffer;
+#    endif
   using io_uring_scheduler = __io_uring::__scheduler;
 
+  inline constexpr __io_uring::__link_t io_uring_link{};
+
   static_assert(__timed_scheduler<io_uring_scheduler>);
 
 } // namespace exec
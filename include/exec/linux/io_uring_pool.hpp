@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../__detail/__cpu_topology.hpp"
+#include "./io_uring_context.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace exec {
+  namespace __io_uring {
+    class __pool;
+
+    // Identifies the ring that is driven by the current thread, if any.
+    struct __pool_thread {
+      const __pool* __pool_{nullptr};
+      std::size_t __index_{0};
+    };
+
+    inline auto __this_pool_thread() noexcept -> __pool_thread& {
+      thread_local __pool_thread __this_thread{};
+      return __this_thread;
+    }
+
+    class __pool_scheduler {
+      __pool* __pool_;
+
+      struct __make_schedule {
+        auto operator()(__scheduler __sched) const -> __scheduler::__schedule_sender {
+          return __sched.schedule();
+        }
+      };
+
+      struct __make_schedule_after {
+        std::chrono::nanoseconds __duration_;
+
+        auto operator()(__scheduler __sched) const -> __scheduler::__schedule_after_sender {
+          return __sched.schedule_after(__duration_);
+        }
+      };
+
+      template <class _Clock, class _Duration>
+      struct __make_schedule_at {
+        std::chrono::time_point<_Clock, _Duration> __time_point_;
+
+        auto operator()(__scheduler __sched) const -> __scheduler::__schedule_after_sender {
+          return __sched.schedule_at(__time_point_);
+        }
+      };
+
+      // Picks the ring when it is connected, so that a sender that is connected on one of the
+      // pool's threads runs on that thread's ring no matter where it was created. Reports the pool
+      // scheduler as the completion scheduler of the ring sender that `_Make` creates.
+      template <class _Make>
+      class __sender {
+        using __ring_sender_t = std::invoke_result_t<const _Make&, __scheduler>;
+
+        _Make __make_;
+        __pool* __pool_;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __sender;
+        using __t = __sender;
+
+        struct __env {
+          __pool* __pool_;
+
+          [[nodiscard]]
+          auto query(stdexec::get_completion_scheduler_t<stdexec::set_value_t>) const noexcept
+            -> __pool_scheduler {
+            return __pool_scheduler{__pool_};
+          }
+        };
+
+        __sender(_Make __make, __pool* __pool) noexcept
+          : __make_{static_cast<_Make&&>(__make)}
+          , __pool_{__pool} {
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __env {
+          return __env{__pool_};
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __sender&, _Env&&...) noexcept
+          -> stdexec::completion_signatures_of_t<__ring_sender_t> {
+          return {};
+        }
+
+        template <stdexec::receiver _Receiver>
+        auto connect(_Receiver __receiver) const & noexcept(
+          stdexec::__nothrow_connectable<__ring_sender_t, _Receiver>)
+          -> stdexec::connect_result_t<__ring_sender_t, _Receiver> {
+          return stdexec::connect(
+            __make_(__pool_scheduler{__pool_}.ring_scheduler()),
+            static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
+     public:
+      explicit __pool_scheduler(__pool* __pool) noexcept
+        : __pool_{__pool} {
+      }
+
+      auto operator==(const __pool_scheduler&) const -> bool = default;
+
+      /// @brief Returns the scheduler of the ring that is driven by the calling thread.
+      ///
+      /// Threads outside of the pool are assigned the rings in round-robin order. Use this
+      /// scheduler to start io operations, e.g. `sched.ring_scheduler().async_read_some(...)`.
+      [[nodiscard]]
+      auto ring_scheduler() const noexcept -> __scheduler;
+
+      /// @brief The ring is picked when the returned sender is connected, see ring_scheduler().
+      [[nodiscard]]
+      auto schedule() const noexcept -> __sender<__make_schedule> {
+        return {__make_schedule{}, __pool_};
+      }
+
+      [[nodiscard]]
+      auto now() const noexcept -> std::chrono::time_point<std::chrono::steady_clock> {
+        return std::chrono::steady_clock::now();
+      }
+
+      [[nodiscard]]
+      auto schedule_after(std::chrono::nanoseconds __duration) const noexcept
+        -> __sender<__make_schedule_after> {
+        return {__make_schedule_after{__duration}, __pool_};
+      }
+
+      template <class _Clock, class _Duration>
+      [[nodiscard]]
+      auto schedule_at(const std::chrono::time_point<_Clock, _Duration>& __time_point) const
+        noexcept -> __sender<__make_schedule_at<_Clock, _Duration>> {
+        return {__make_schedule_at<_Clock, _Duration>{__time_point}, __pool_};
+      }
+    };
+
+    /// @brief Owns a number of io_uring contexts, each of which is driven by its own thread.
+    ///
+    /// All rings share the kernel's async workers (IORING_SETUP_ATTACH_WQ). Work that is
+    /// scheduled from one of the pool's threads stays on that thread's ring, other threads are
+    /// distributed over the rings in round-robin order. With a placement other than
+    /// cpu_placement::none, the thread of ring `i` is pinned to the `i`-th CPU of that placement.
+    class __pool : stdexec::__immovable {
+     public:
+      explicit __pool(
+        std::size_t __n_rings = std::thread::hardware_concurrency(),
+        unsigned __entries = 1024,
+        const __options& __opts = {},
+        affinity_params __affinity = {})
+        : __affinity_{__affinity} {
+        __n_rings = std::max<std::size_t>(__n_rings, 1);
+        const std::vector<cpu_info> __cpus = cpu_topology::current().place(__affinity_);
+        __contexts_.reserve(__n_rings);
+        __threads_.reserve(__n_rings);
+        __contexts_.push_back(std::make_unique<__context>(__entries, __opts));
+        __options __attached = __opts;
+        __attached.attach_wq = __contexts_.front()->native_handle();
+        for (std::size_t __i = 1; __i < __n_rings; ++__i) {
+          __contexts_.push_back(std::make_unique<__context>(__entries, __attached));
+        }
+        scope_guard __stop_on_error{[&]() noexcept { __stop(); }};
+        for (std::size_t __i = 0; __i < __n_rings; ++__i) {
+          const int __cpu = __cpus.empty() ? -1 : __cpus[__i % __cpus.size()].cpu;
+          __threads_.emplace_back([this, __i, __cpu] {
+            if (__cpu >= 0) {
+              pin_this_thread_to_cpu(__cpu);
+            }
+            __this_pool_thread() = __pool_thread{this, __i};
+            __contexts_[__i]->run_until_stopped();
+          });
+        }
+        __stop_on_error.dismiss();
+      }
+
+      ~__pool() {
+        __stop();
+      }
+
+      /// @brief Requests all rings to stop. Operations that are in flight complete with
+      /// set_stopped.
+      void request_stop() noexcept {
+        for (auto& __context: __contexts_) {
+          if (auto __ec = __context->request_stop()) {
+            std::terminate();
+          }
+        }
+      }
+
+      [[nodiscard]]
+      auto get_scheduler() noexcept -> __pool_scheduler {
+        return __pool_scheduler{this};
+      }
+
+      [[nodiscard]]
+      auto size() const noexcept -> std::size_t {
+        return __contexts_.size();
+      }
+
+      /// @brief Returns the ring at @p __index, e.g. to register buffers or files with it.
+      [[nodiscard]]
+      auto ring(std::size_t __index) noexcept -> __context& {
+        return *__contexts_[__index];
+      }
+
+      [[nodiscard]]
+      auto affinity() const noexcept -> affinity_params {
+        return __affinity_;
+      }
+
+      /// @brief Returns the id of the thread that drives the ring at @p __index.
+      [[nodiscard]]
+      auto get_thread_id(std::size_t __index) const noexcept -> std::thread::id {
+        return __threads_[__index].get_id();
+      }
+
+     private:
+      friend class __pool_scheduler;
+
+      auto __pick() noexcept -> __context& {
+        const __pool_thread& __this_thread = __this_pool_thread();
+        if (__this_thread.__pool_ == this) {
+          return *__contexts_[__this_thread.__index_];
+        }
+        std::size_t __index = __next_.fetch_add(1, std::memory_order_relaxed);
+        return *__contexts_[__index % __contexts_.size()];
+      }
+
+      void __stop() noexcept {
+        request_stop();
+        for (std::thread& __worker: __threads_) {
+          if (__worker.joinable()) {
+            __worker.join();
+          }
+        }
+      }
+
+      affinity_params __affinity_;
+      std::vector<std::unique_ptr<__context>> __contexts_;
+      std::vector<std::thread> __threads_;
+      std::atomic<std::size_t> __next_{0};
+    };
+
+    inline auto __pool_scheduler::ring_scheduler() const noexcept -> __scheduler {
+      return __pool_->__pick().get_scheduler();
+    }
+  } // namespace __io_uring
+
+  using io_uring_pool = __io_uring::__pool;
+  using io_uring_pool_scheduler = __io_uring::__pool_scheduler;
+
+  static_assert(__timed_scheduler<io_uring_pool_scheduler>);
+} // namespace exec
@@ -22,35 +22,205 @@
 #include "../stdexec/__detail/__intrusive_queue.hpp"
 #include "../stdexec/__detail/__meta.hpp"
 #include "../stdexec/__detail/__manual_lifetime.hpp"
+#include "../stdexec/__detail/__spin_loop_pause.hpp"
 #include "__detail/__atomic_intrusive_queue.hpp"
 #include "__detail/__bwos_lifo_queue.hpp"
+#include "__detail/__cpu_topology.hpp"
 #include "__detail/__xorshift.hpp"
 #include "__detail/__numa.hpp"
+#include "__detail/__timer_wheel.hpp"
 
 #include "sequence_senders.hpp"
 #include "sequence/iterate.hpp"
+#include "timed_scheduler.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <compare>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <thread>
 #include <type_traits>
 #include <vector>
 
+// Maintain per-worker event counters, see `static_thread_pool::stats()`. All translation units
+// of a program must agree on this setting.
+#ifndef STDEXEC_STATIC_THREAD_POOL_STATISTICS
+#  define STDEXEC_STATIC_THREAD_POOL_STATISTICS 0
+#endif
+
+// The counters change the layout of the pool. With them, the pool types carry an ABI tag, so
+// that translation units that disagree on the setting do not share the definitions of these
+// types, and fail to link where they pass a pool to each other.
+#if STDEXEC_STATIC_THREAD_POOL_STATISTICS && (STDEXEC_GCC() || STDEXEC_CLANG())
+#  define STDEXEC_STATIC_THREAD_POOL_ABI_TAG [[gnu::abi_tag("stdexec_pool_statistics")]]
+#else
+#  define STDEXEC_STATIC_THREAD_POOL_ABI_TAG
+#endif
+
 namespace exec {
   struct bwos_params {
     std::size_t numBlocks{32};
     std::size_t blockSize{8};
+    bwos::lifo_queue_layout layout{};
+  };
+
+  // Controls how long an idle worker looks for new work before it parks on a futex.
+  // The number of polling rounds adapts between `minSpins` and `maxSpins` depending on how
+  // often spinning found work recently. `maxSpins == 0` parks idle workers immediately.
+  struct spin_params {
+    std::uint32_t minSpins{1};
+    std::uint32_t maxSpins{64};
+    std::uint32_t pausesPerSpin{16};
+  };
+
+  enum class bulk_chunking {
+    // Every execution agent runs one contiguous share of the shape, see `even_share`.
+    static_share,
+    // Execution agents claim chunks of `grainSize` indices from a shared cursor until the whole
+    // shape is drained, so that a slow chunk does not hold back the rest of the work.
+    dynamic
+  };
+
+  struct bulk_params {
+    bulk_chunking chunking{bulk_chunking::static_share};
+    // The number of indices per dynamic chunk. 0 picks roughly eight chunks per agent.
+    std::size_t grainSize{0};
+  };
+
+  // Limits how many workers the pool spreads new work over while it is lightly loaded, so that
+  // fewer workers are woken up and the work stays on fewer cores.
+  // The number of active workers starts at the thread count of the pool. It shrinks by one
+  // whenever a worker goes to sleep `shrinkAfter` times in a row while less than half of the
+  // active workers are awake, but never below `minThreads`. It grows by one whenever work is
+  // queued or stolen while every active worker is busy.
+  // This only limits where work is distributed. Inactive workers keep their threads and queues
+  // and still run work that targets them explicitly, such as tasks of `get_scheduler_on_thread`.
+  // `minThreads == 0` spreads new work over every worker.
+  struct spread_params {
+    std::uint32_t minThreads{0};
+    std::uint32_t shrinkAfter{16};
+  };
+
+  // What a `schedule()` operation of a bounded `static_thread_pool` does when all slots are taken.
+  enum class overflow_policy : std::uint8_t {
+    // Wait for a free slot without blocking the starting thread.
+    wait,
+    // Complete with `set_stopped` right away, which sheds the load.
+    stop
+  };
+
+  // Bounds the number of `schedule()` operations that threads outside of the pool may have
+  // queued at once. An operation holds its slot until a worker runs it. Work that the workers
+  // schedule themselves is not bounded. `capacity == 0` means unbounded.
+  struct backpressure_params {
+    std::size_t capacity{0};
+    overflow_policy onFull{overflow_policy::wait};
+  };
+
+  // Selects the lane of a `static_thread_pool` that a scheduler submits its work to. Workers run
+  // `high` tasks before `normal` ones, except that they take a `normal` task after a bounded
+  // number of `high` ones so that `normal` work is not starved.
+  enum class task_priority : std::uint8_t {
+    high,
+    normal
+  };
+
+  // The tuning knobs of a `static_thread_pool`. Name the ones to change and leave the rest at
+  // their defaults, e.g. `static_thread_pool pool{8, {.spin = {.maxSpins = 0}}}`.
+  struct static_thread_pool_options {
+    bwos_params bwos{};
+    numa_policy numa = get_numa_policy();
+    spin_params spin{};
+    bulk_params bulk{};
+    spread_params spread{};
+    affinity_params affinity{};
+    backpressure_params backpressure{};
+  };
+
+  // A snapshot of the event counters of one `static_thread_pool` worker.
+  struct thread_pool_worker_stats {
+    std::uint64_t tasksExecuted{0};
+    // Tasks taken from the worker's own BWOS queue.
+    std::uint64_t localPops{0};
+    // Tasks taken after draining the remote queues of the worker.
+    std::uint64_t remotePops{0};
+    std::uint64_t nearStealAttempts{0};
+    std::uint64_t nearSteals{0};
+    std::uint64_t anyStealAttempts{0};
+    std::uint64_t anySteals{0};
+    std::uint64_t sleeps{0};
+    // Sleeps that ended because another thread notified the worker.
+    std::uint64_t wakeups{0};
+    // Pushes that did not fit into the BWOS queue and were kept in the pending queue.
+    std::uint64_t pendingOverflows{0};
   };
 
   namespace _pool_ {
     using namespace stdexec;
 
+    // The counters of one worker. Only the owning worker increments them, so an increment is a
+    // relaxed load and store. Without STDEXEC_STATIC_THREAD_POOL_STATISTICS this is empty and
+    // incrementing it does nothing.
+    class STDEXEC_STATIC_THREAD_POOL_ABI_TAG worker_counters {
+     public:
+      enum counter : std::uint32_t {
+        tasks_executed,
+        local_pops,
+        remote_pops,
+        near_steal_attempts,
+        near_steals,
+        any_steal_attempts,
+        any_steals,
+        sleeps,
+        wakeups,
+        pending_overflows,
+        num_counters
+      };
+
+      void increment([[maybe_unused]] counter which) noexcept {
+#if STDEXEC_STATIC_THREAD_POOL_STATISTICS
+        std::atomic<std::uint64_t>& value = values_[which];
+        value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+#endif
+      }
+
+      [[nodiscard]]
+      auto snapshot() const noexcept -> thread_pool_worker_stats {
+        thread_pool_worker_stats stats{};
+#if STDEXEC_STATIC_THREAD_POOL_STATISTICS
+        auto get = [this](counter which) {
+          return values_[which].load(std::memory_order_relaxed);
+        };
+        stats.tasksExecuted = get(tasks_executed);
+        stats.localPops = get(local_pops);
+        stats.remotePops = get(remote_pops);
+        stats.nearStealAttempts = get(near_steal_attempts);
+        stats.nearSteals = get(near_steals);
+        stats.anyStealAttempts = get(any_steal_attempts);
+        stats.anySteals = get(any_steals);
+        stats.sleeps = get(sleeps);
+        stats.wakeups = get(wakeups);
+        stats.pendingOverflows = get(pending_overflows);
+#endif
+        return stats;
+      }
+
+     private:
+#if STDEXEC_STATIC_THREAD_POOL_STATISTICS
+      std::array<std::atomic<std::uint64_t>, num_counters> values_{};
+#endif
+    };
+
+    inline constexpr std::size_t num_priorities = 2;
+
     // Splits `n` into `size` chunks distributing `n % size` evenly between ranks.
     // Returns `[begin, end)` range in `n` for a given `rank`.
     // Example:
@@ -96,17 +266,109 @@ namespace exec {
       void (*__execute)(task_base*, std::uint32_t tid) noexcept = nullptr;
     };
 
+    struct timer_base;
+
+    // A `schedule()` operation that waits for a slot of a bounded pool.
+    struct backpressure_waiter {
+      backpressure_waiter* next_{nullptr};
+      void (*admit_)(backpressure_waiter*) noexcept = nullptr;
+      // Set by `cancel_wait`, so that a waiter whose stop was requested before it got queued is
+      // not queued anymore. Guarded by the waiters mutex of the pool.
+      bool cancelled_{false};
+    };
+
+    // A request to a worker to arm or to cancel one of its timers. Every timer is owned by a
+    // single worker and other threads only talk to that worker through its timer commands.
+    struct timer_command {
+      timer_command* next_{nullptr};
+      timer_base* timer_{nullptr};
+    };
+
+    // The absolute or relative point in time at which a timer expires.
+    struct timer_deadline {
+      std::chrono::steady_clock::time_point time_point_{};
+      std::chrono::steady_clock::duration duration_{};
+      bool relative_{false};
+
+      [[nodiscard]]
+      auto resolve() const noexcept -> std::chrono::steady_clock::time_point {
+        return relative_ ? std::chrono::steady_clock::now() + duration_ : time_point_;
+      }
+    };
+
+    // A timer is executed as a task on the pool once it expired or got cancelled.
+    struct timer_base : task_base {
+      // Only accessed by the owning worker once it claimed the timer.
+      enum class state : unsigned char {
+        armed,
+        fired
+      };
+
+      enum class completion : unsigned char {
+        value,
+        stopped,
+        // The last reference has already been dropped by the worker.
+        stopped_unreferenced
+      };
+
+      // Set in `ref_count_` by the owning worker when it takes the schedule command. A stop
+      // request that comes earlier only adds its reference and the owner cancels the timer when it
+      // claims it, so that a stop command never overtakes the schedule command.
+      static constexpr int claimed_flag = 1 << 16;
+
+      static constexpr auto references(int count) noexcept -> int {
+        return count & ~claimed_flag;
+      }
+
+      explicit timer_base(void (*complete)(timer_base*, bool stopped) noexcept) noexcept
+        : complete_{complete} {
+        this->__execute = [](task_base* t, const std::uint32_t /* tid */) noexcept {
+          auto* self = static_cast<timer_base*>(t);
+          const completion how = self->completion_;
+          if (
+            how == completion::stopped_unreferenced
+            || references(self->ref_count_.fetch_sub(1, std::memory_order_acq_rel)) == 1) {
+            self->complete_(self, how != completion::value);
+          }
+        };
+      }
+
+      std::chrono::steady_clock::time_point deadline_{};
+      std::uint64_t tick_{0};
+      timer_base* wheel_next_{nullptr};
+      timer_base** wheel_pprev_{nullptr};
+      timer_command schedule_command_{.next_ = nullptr, .timer_ = this};
+      timer_command stop_command_{.next_ = nullptr, .timer_ = this};
+      // Written before the timer is published through `ref_count_`.
+      std::uint32_t owner_{0};
+      task_priority priority_{task_priority::normal};
+      state state_{state::armed};
+      completion completion_{completion::value};
+      // One reference for the armed timer and one for a pending stop request, plus `claimed_flag`.
+      std::atomic<int> ref_count_{0};
+      void (*complete_)(timer_base*, bool stopped) noexcept;
+    };
+
     struct remote_queue {
       explicit remote_queue(std::size_t nthreads) noexcept
-        : queues_(nthreads) {
+        : nthreads_(nthreads)
+        , queues_(nthreads * num_priorities) {
       }
 
       explicit remote_queue(remote_queue* next, std::size_t nthreads) noexcept
         : next_(next)
-        , queues_(nthreads) {
+        , nthreads_(nthreads)
+        , queues_(nthreads * num_priorities) {
+      }
+
+      auto queue(std::size_t tid, task_priority priority = task_priority::normal) noexcept
+        -> __atomic_intrusive_queue<&task_base::next>& {
+        return queues_[static_cast<std::size_t>(priority) * nthreads_ + tid];
       }
 
       remote_queue* next_{};
+      std::size_t nthreads_;
+      // One queue per thread for each priority.
       std::vector<__atomic_intrusive_queue<&task_base::next>> queues_{};
       std::thread::id id_{std::this_thread::get_id()};
       // This marks whether the submitter is a thread in the pool or not.
@@ -136,11 +398,16 @@ namespace exec {
         }
       }
 
-      auto pop_all_reversed(std::size_t tid) noexcept -> __intrusive_queue<&task_base::next> {
+      auto pop_all_reversed(std::size_t tid, task_priority priority) noexcept
+        -> __intrusive_queue<&task_base::next> {
         remote_queue* head = head_.load(std::memory_order_acquire);
         __intrusive_queue<&task_base::next> tasks{};
         while (head != nullptr) {
-          tasks.append(head->queues_[tid].pop_all_reversed());
+          auto& queue = head->queue(tid, priority);
+          // Avoid taking the cache line of empty queues away from their producers.
+          if (!queue.empty()) {
+            tasks.append(queue.pop_all_reversed());
+          }
           head = head->next_;
         }
         return tasks;
@@ -164,25 +431,38 @@ namespace exec {
       }
     };
 
-    class static_thread_pool_ {
+    class STDEXEC_STATIC_THREAD_POOL_ABI_TAG static_thread_pool_ {
       template <class ReceiverId>
       struct operation {
         using Receiver = stdexec::__t<ReceiverId>;
         class __t;
       };
 
+      template <class ReceiverId>
+      struct timer_operation {
+        using Receiver = stdexec::__t<ReceiverId>;
+        class __t;
+      };
+
       struct schedule_tag {
         // TODO: code to reconstitute a static_thread_pool_ schedule sender
       };
 
-      template <class SenderId, bool parallelize, std::integral Shape, class Fun>
+      template <
+        class SenderId,
+        bool is_unchunked,
+        bool parallelize,
+        std::integral Shape,
+        class Fun
+      >
       struct bulk_sender {
         using Sender = stdexec::__t<SenderId>;
         struct __t;
       };
 
-      template <sender Sender, bool parallelize, std::integral Shape, class Fun>
-      using bulk_sender_t = __t<bulk_sender<__id<__decay_t<Sender>>, parallelize, Shape, Fun>>;
+      template <sender Sender, bool is_unchunked, bool parallelize, std::integral Shape, class Fun>
+      using bulk_sender_t =
+        __t<bulk_sender<__id<__decay_t<Sender>>, is_unchunked, parallelize, Shape, Fun>>;
 
 #if STDEXEC_MSVC()
       // MSVCBUG https://developercommunity.visualstudio.com/t/Alias-template-with-pack-expansion-in-no/10437850
@@ -208,9 +488,28 @@ namespace exec {
         // there's no need to advertise completion with `exception_ptr`
       >;
 
+      template <class Fun, class Shape, class... Args>
+        requires __callable<Fun, Shape, Args&...>
+      using bulk_unchunked_non_throwing = __mbool<
+        __nothrow_callable<Fun, Shape, Args&...> &&
+#if STDEXEC_MSVC()
+        __bulk_non_throwing<Args...>::__v
+#else
+        noexcept(__decayed_std_tuple<Args...>(std::declval<Args>()...))
+#endif
+      >;
+
+      template <bool is_unchunked, class Fun, class Shape>
+      using bulk_non_throwing_q = __if_c<
+        is_unchunked,
+        __mbind_front_q<bulk_unchunked_non_throwing, Fun, Shape>,
+        __mbind_front_q<bulk_non_throwing, Fun, Shape>
+      >;
+
       template <
         class CvrefSender,
         class Receiver,
+        bool is_unchunked,
         bool parallelize,
         class Shape,
         class Fun,
@@ -221,6 +520,7 @@ namespace exec {
       template <
         class CvrefSenderId,
         class ReceiverId,
+        bool is_unchunked,
         bool parallelize,
         class Shape,
         class Fun,
@@ -235,18 +535,26 @@ namespace exec {
       template <
         class CvrefSender,
         class Receiver,
+        bool is_unchunked,
         bool parallelize,
         class Shape,
         class Fun,
         bool MayThrow
       >
-      using bulk_receiver_t = __t<
-        bulk_receiver<__cvref_id<CvrefSender>, __id<Receiver>, parallelize, Shape, Fun, MayThrow>
-      >;
+      using bulk_receiver_t = __t<bulk_receiver<
+        __cvref_id<CvrefSender>,
+        __id<Receiver>,
+        is_unchunked,
+        parallelize,
+        Shape,
+        Fun,
+        MayThrow
+      >>;
 
       template <
         class CvrefSenderId,
         class ReceiverId,
+        bool is_unchunked,
         bool parallelize,
         std::integral Shape,
         class Fun
@@ -257,19 +565,36 @@ namespace exec {
         struct __t;
       };
 
-      template <class Sender, class Receiver, bool parallelize, std::integral Shape, class Fun>
-      using bulk_op_state_t = __t<
-        bulk_op_state<__id<__decay_t<Sender>>, __id<__decay_t<Receiver>>, parallelize, Shape, Fun>
-      >;
+      template <
+        class Sender,
+        class Receiver,
+        bool is_unchunked,
+        bool parallelize,
+        std::integral Shape,
+        class Fun
+      >
+      using bulk_op_state_t = __t<bulk_op_state<
+        __id<__decay_t<Sender>>,
+        __id<__decay_t<Receiver>>,
+        is_unchunked,
+        parallelize,
+        Shape,
+        Fun
+      >>;
+
+      template <class Sender>
+      static constexpr bool is_bulk_chunked_or_unchunked =
+        sender_expr_for<Sender, bulk_chunked_t> || sender_expr_for<Sender, bulk_unchunked_t>;
 
       struct transform_bulk {
-        template <class Data, class Sender>
-        auto operator()(bulk_chunked_t, Data&& data, Sender&& sndr) {
+        template <class Tag, class Data, class Sender>
+        auto operator()(Tag, Data&& data, Sender&& sndr) {
           auto [pol, shape, fun] = static_cast<Data&&>(data);
           using policy_t = std::remove_cvref_t<decltype(pol.__get())>;
           constexpr bool parallelize = std::same_as<policy_t, parallel_policy>
                                     || std::same_as<policy_t, parallel_unsequenced_policy>;
-          return bulk_sender_t<Sender, parallelize, decltype(shape), decltype(fun)>{
+          constexpr bool is_unchunked = std::same_as<Tag, bulk_unchunked_t>;
+          return bulk_sender_t<Sender, is_unchunked, parallelize, decltype(shape), decltype(fun)>{
             pool_, static_cast<Sender&&>(sndr), shape, std::move(fun)};
         }
 
@@ -295,7 +620,8 @@ namespace exec {
      public:
       struct domain : stdexec::default_domain {
         // For eager customization
-        template <sender_expr_for<bulk_chunked_t> Sender>
+        template <class Sender>
+          requires is_bulk_chunked_or_unchunked<Sender>
         auto transform_sender(Sender&& sndr) const noexcept {
           if constexpr (__completes_on<Sender, static_thread_pool_::scheduler>) {
             auto sched = get_completion_scheduler<set_value_t>(get_env(sndr));
@@ -309,8 +635,10 @@ namespace exec {
           }
         }
 
-        // transform the generic bulk_chunked sender into a parallel thread-pool bulk sender
-        template <sender_expr_for<bulk_chunked_t> Sender, class Env>
+        // transform the generic bulk_chunked and bulk_unchunked senders into a parallel
+        // thread-pool bulk sender
+        template <class Sender, class Env>
+          requires is_bulk_chunked_or_unchunked<Sender>
         auto transform_sender(Sender&& sndr, const Env& env) const noexcept {
           if constexpr (__starts_on<Sender, static_thread_pool_::scheduler, Env>) {
             auto sched = stdexec::get_scheduler(env);
@@ -346,6 +674,7 @@ namespace exec {
         std::uint32_t threadCount,
         bwos_params params = {},
         numa_policy numa = get_numa_policy());
+      static_thread_pool_(std::uint32_t threadCount, static_thread_pool_options options);
       ~static_thread_pool_();
 
       struct scheduler {
@@ -357,11 +686,12 @@ namespace exec {
           struct env {
             static_thread_pool_& pool_;
             remote_queue* queue_;
+            task_priority priority_;
 
             template <class CPO>
             auto query(get_completion_scheduler_t<CPO>) const noexcept
               -> static_thread_pool_::scheduler {
-              return static_thread_pool_::scheduler{pool_, *queue_};
+              return static_thread_pool_::scheduler{pool_, *queue_, priority_};
             }
           };
 
@@ -377,13 +707,13 @@ namespace exec {
 
           [[nodiscard]]
           auto get_env() const noexcept -> env {
-            return env{.pool_ = pool_, .queue_ = queue_};
+            return env{.pool_ = pool_, .queue_ = queue_, .priority_ = priority_};
           }
 
           template <receiver Receiver>
           auto connect(Receiver rcvr) const -> operation_t<Receiver> {
             return operation_t<Receiver>{
-              pool_, queue_, static_cast<Receiver&&>(rcvr), threadIndex_, constraints_};
+              pool_, queue_, static_cast<Receiver&&>(rcvr), threadIndex_, constraints_, priority_};
           }
 
          private:
@@ -393,17 +723,74 @@ namespace exec {
             static_thread_pool_& pool,
             remote_queue* queue,
             std::size_t threadIndex,
-            const nodemask& constraints) noexcept
+            const nodemask& constraints,
+            task_priority priority) noexcept
             : pool_(pool)
             , queue_(queue)
             , threadIndex_(threadIndex)
-            , constraints_(constraints) {
+            , constraints_(constraints)
+            , priority_(priority) {
           }
 
           static_thread_pool_& pool_;
           remote_queue* queue_;
           std::size_t threadIndex_{std::numeric_limits<std::size_t>::max()};
           nodemask constraints_{};
+          task_priority priority_;
+        };
+
+        class _timer_sender {
+          struct env {
+            static_thread_pool_& pool_;
+            remote_queue* queue_;
+            task_priority priority_;
+
+            template <class CPO>
+            auto query(get_completion_scheduler_t<CPO>) const noexcept
+              -> static_thread_pool_::scheduler {
+              return static_thread_pool_::scheduler{pool_, *queue_, priority_};
+            }
+          };
+
+         public:
+          using __t = _timer_sender;
+          using __id = _timer_sender;
+          using sender_concept = sender_t;
+          template <class Receiver>
+          using operation_t = stdexec::__t<timer_operation<stdexec::__id<Receiver>>>;
+
+          using completion_signatures =
+            stdexec::completion_signatures<set_value_t(), set_stopped_t()>;
+
+          [[nodiscard]]
+          auto get_env() const noexcept -> env {
+            return env{.pool_ = pool_, .queue_ = queue_, .priority_ = priority_};
+          }
+
+          template <receiver Receiver>
+          auto connect(Receiver rcvr) const -> operation_t<Receiver> {
+            return operation_t<Receiver>{
+              pool_, deadline_, priority_, static_cast<Receiver&&>(rcvr)};
+          }
+
+         private:
+          friend struct static_thread_pool_::scheduler;
+
+          explicit _timer_sender(
+            static_thread_pool_& pool,
+            remote_queue* queue,
+            timer_deadline deadline,
+            task_priority priority) noexcept
+            : pool_(pool)
+            , queue_(queue)
+            , deadline_(deadline)
+            , priority_(priority) {
+          }
+
+          static_thread_pool_& pool_;
+          remote_queue* queue_;
+          timer_deadline deadline_;
+          task_priority priority_;
         };
 
         friend class static_thread_pool_;
@@ -431,13 +818,25 @@ namespace exec {
           std::size_t threadIndex) noexcept
           : pool_(&pool)
           , queue_{&queue}
-          , thread_idx_{threadIndex} {
+          , thread_idx_{static_cast<std::uint32_t>(threadIndex)} {
+        }
+
+        explicit scheduler(
+          static_thread_pool_& pool,
+          remote_queue& queue,
+          task_priority priority) noexcept
+          : pool_(&pool)
+          , queue_{&queue}
+          , priority_{priority} {
         }
 
         static_thread_pool_* pool_;
         remote_queue* queue_;
         const nodemask* nodemask_ = &nodemask::any();
-        std::size_t thread_idx_{std::numeric_limits<std::size_t>::max()};
+        // 32 bits leave room for the priority, so that the scheduler stays small enough for the
+        // inline buffer of `any_scheduler`.
+        std::uint32_t thread_idx_{std::numeric_limits<std::uint32_t>::max()};
+        task_priority priority_{task_priority::normal};
 
        public:
         using __t = scheduler;
@@ -446,7 +845,34 @@ namespace exec {
 
         [[nodiscard]]
         auto schedule() const noexcept -> _sender {
-          return _sender{*pool_, queue_, thread_idx_, *nodemask_};
+          return _sender{*pool_, queue_, thread_idx_, *nodemask_, priority_};
+        }
+
+        [[nodiscard]]
+        auto priority() const noexcept -> task_priority {
+          return priority_;
+        }
+
+        [[nodiscard]]
+        static auto now() noexcept -> std::chrono::steady_clock::time_point {
+          return std::chrono::steady_clock::now();
+        }
+
+        //! Completes on the pool once `time_point` has been reached. The timer is kept by the
+        //! calling worker, or by a random worker if called from outside of the pool.
+        [[nodiscard]]
+        auto schedule_at(std::chrono::steady_clock::time_point time_point) const noexcept
+          -> _timer_sender {
+          return _timer_sender{
+            *pool_, queue_, timer_deadline{.time_point_ = time_point}, priority_};
+        }
+
+        //! Completes on the pool once `duration` has passed since the operation was started.
+        [[nodiscard]]
+        auto schedule_after(std::chrono::steady_clock::duration duration) const noexcept
+          -> _timer_sender {
+          return _timer_sender{
+            *pool_, queue_, timer_deadline{.duration_ = duration, .relative_ = true}, priority_};
         }
 
         [[nodiscard]]
@@ -464,6 +890,15 @@ namespace exec {
         return scheduler{*this};
       }
 
+      //! Returns a scheduler that submits its work to the lane of `priority`. Bulk work always
+      //! runs in the `normal` lane.
+      auto get_scheduler(task_priority priority) noexcept -> scheduler {
+        if (priority != task_priority::normal) {
+          usesPriorities_.store(true, std::memory_order_relaxed);
+        }
+        return scheduler{*this, *get_remote_queue(), priority};
+      }
+
       auto get_scheduler_on_thread(std::size_t threadIndex) noexcept -> scheduler {
         return scheduler{*this, *get_remote_queue(), threadIndex};
       }
@@ -499,18 +934,87 @@ namespace exec {
         return params_;
       }
 
+      [[nodiscard]]
+      auto spin() const -> spin_params {
+        return spin_;
+      }
+
+      [[nodiscard]]
+      auto bulk() const -> bulk_params {
+        return bulk_;
+      }
+
+      [[nodiscard]]
+      auto spread() const -> spread_params {
+        return spread_;
+      }
+
+      [[nodiscard]]
+      auto affinity() const -> affinity_params {
+        return affinity_;
+      }
+
+      [[nodiscard]]
+      auto backpressure() const -> backpressure_params {
+        return backpressure_;
+      }
+
+      //! The number of workers that new work is distributed to. This is `available_parallelism()`
+      //! unless the pool was constructed with `spread_params`.
+      [[nodiscard]]
+      auto active_thread_count() const noexcept -> std::uint32_t {
+        return activeThreads_.load(std::memory_order_relaxed);
+      }
+
+      //! Returns the counters of every worker. The pool keeps running while they are read, so
+      //! the counters of different workers are not from the same instant. All counters are zero
+      //! unless STDEXEC_STATIC_THREAD_POOL_STATISTICS is defined to a non-zero value.
+      [[nodiscard]]
+      auto stats() const -> std::vector<thread_pool_worker_stats> {
+        std::vector<thread_pool_worker_stats> result;
+        result.reserve(threadStates_.size());
+        for (const auto& state: threadStates_) {
+          result.push_back(state->counters().snapshot());
+        }
+        return result;
+      }
+
+      //! Returns the NUMA node of the calling worker, or -1 for threads that are not workers of
+      //! this pool.
+      [[nodiscard]]
+      auto calling_numa_node() const noexcept -> int {
+        const this_worker_t& worker = this_worker();
+        if (worker.pool_ != this) {
+          return -1;
+        }
+        return threadStates_[worker.index_]->numa_node();
+      }
+
+      //! Returns an allocator for the NUMA node of the calling worker. Threads that are not
+      //! workers of this pool get an allocator for their own heap.
+      template <class T = std::byte>
+      [[nodiscard]]
+      auto get_allocator() const noexcept -> node_allocator<T> {
+        return node_allocator<T>{calling_numa_node()};
+      }
+
       void enqueue(task_base* task, const nodemask& contraints = nodemask::any()) noexcept;
       void enqueue(
         remote_queue& queue,
         task_base* task,
-        const nodemask& contraints = nodemask::any()) noexcept;
-      void enqueue(remote_queue& queue, task_base* task, std::size_t threadIndex) noexcept;
+        const nodemask& contraints = nodemask::any(),
+        task_priority priority = task_priority::normal) noexcept;
+      void enqueue(
+        remote_queue& queue,
+        task_base* task,
+        std::size_t threadIndex,
+        task_priority priority = task_priority::normal) noexcept;
 
       //! Enqueue a contiguous span of tasks across task queues.
       //! Note: We use the concrete `TaskT` because we enqueue
       //! tasks `task + 0`, `task + 1`, etc. so std::span<task_base>
       //! wouldn't be correct.
-      //! This is O(n_threads) on the calling thread.
+      //! This is O(n_threads) on the calling thread and notifies each worker at most once.
       template <std::derived_from<task_base> TaskT>
       void bulk_enqueue(TaskT* task, std::uint32_t n_threads) noexcept;
       void bulk_enqueue(
@@ -519,20 +1023,76 @@ namespace exec {
         std::size_t tasks_size,
         const nodemask& constraints = nodemask::any()) noexcept;
 
+      //! Submits `tasks_size` tasks at once. The tasks go to the workers with the fewest queued
+      //! tasks first and every worker is notified at most once. Sleeping workers are only woken
+      //! up if no thief is around to spread the tasks, see `distribute`.
+      void enqueue_batch(
+        __intrusive_queue<&task_base::next> tasks,
+        std::size_t tasks_size,
+        const nodemask& constraints = nodemask::any()) noexcept {
+        bulk_enqueue(*get_remote_queue(), std::move(tasks), tasks_size, constraints);
+      }
+
+      //! Picks the calling worker as the owner of a new timer, or a random one for other threads.
+      auto pick_timer_owner() noexcept -> std::uint32_t;
+      //! Hands a started timer to its owner.
+      void schedule_timer(timer_base* timer) noexcept;
+      //! Asks the worker that owns `timer` to complete it with `set_stopped`.
+      void cancel_timer(timer_base* timer) noexcept;
+
      private:
+      // Timers are kept in ticks since the construction of the pool.
+      using timer_tick = std::chrono::duration<std::int64_t, std::ratio<1, 10'000>>;
+
+      struct this_worker_t {
+        const static_thread_pool_* pool_{nullptr};
+        std::uint32_t index_{0};
+      };
+
+      static auto this_worker() noexcept -> this_worker_t& {
+        thread_local this_worker_t worker{};
+        return worker;
+      }
+
+      [[nodiscard]]
+      auto to_tick(std::chrono::steady_clock::time_point time_point) const noexcept
+        -> std::uint64_t {
+        if (time_point <= timerEpoch_) {
+          return 0;
+        }
+        return static_cast<std::uint64_t>(
+          std::chrono::ceil<timer_tick>(time_point - timerEpoch_).count());
+      }
+
+      [[nodiscard]]
+      auto current_tick() const noexcept -> std::uint64_t {
+        return static_cast<std::uint64_t>(
+          std::chrono::floor<timer_tick>(std::chrono::steady_clock::now() - timerEpoch_).count());
+      }
+
+      using local_queue_t = bwos::lifo_queue<task_base*, numa_allocator<task_base*>>;
+
       class workstealing_victim {
        public:
         explicit workstealing_victim(
-          bwos::lifo_queue<task_base*, numa_allocator<task_base*>>* queue,
+          local_queue_t* normal,
+          const std::atomic<local_queue_t*>* high,
           std::uint32_t index,
-          int numa_node) noexcept
-          : queue_(queue)
+          int numa_node,
+          int l3) noexcept
+          : normal_(normal)
+          , high_(high)
           , index_(index)
-          , numa_node_(numa_node) {
+          , numa_node_(numa_node)
+          , l3_(l3) {
         }
 
-        auto try_steal() noexcept -> task_base* {
-          return queue_->steal_front();
+        auto try_steal(task_priority priority) noexcept -> task_base* {
+          if (priority == task_priority::normal) {
+            return normal_->steal_front();
+          }
+          local_queue_t* high = high_->load(std::memory_order_acquire);
+          return high ? high->steal_front() : nullptr;
         }
 
         [[nodiscard]]
@@ -545,20 +1105,43 @@ namespace exec {
           return numa_node_;
         }
 
+        [[nodiscard]]
+        auto l3() const noexcept -> int {
+          return l3_;
+        }
+
        private:
-        bwos::lifo_queue<task_base*, numa_allocator<task_base*>>* queue_;
+        // The local queues of the victim. Its `high` lane does not exist until it gets `high` work.
+        local_queue_t* normal_;
+        const std::atomic<local_queue_t*>* high_;
         std::uint32_t index_;
         int numa_node_;
+        int l3_;
       };
 
       struct thread_state_base {
-        explicit thread_state_base(std::uint32_t index, const numa_policy& numa) noexcept
+        explicit thread_state_base(
+          std::uint32_t index,
+          const numa_policy& numa,
+          const cpu_info* cpu) noexcept
           : index_(index)
-          , numa_node_(numa.thread_index_to_node(index)) {
+          , numa_node_(numa_node_of(index, numa, cpu))
+          , l3_(cpu ? cpu->l3 : -1) {
+        }
+
+        // A pinned worker belongs to the node of its CPU if the NUMA policy knows that node.
+        static auto numa_node_of(std::uint32_t index, const numa_policy& numa, const cpu_info* cpu)
+          -> int {
+          if (cpu && cpu->node >= 0 && static_cast<std::size_t>(cpu->node) < numa.num_nodes()) {
+            return cpu->node;
+          }
+          return numa.thread_index_to_node(index);
         }
 
         std::uint32_t index_;
         int numa_node_;
+        // The L3 cache of the CPU this worker is pinned to, or -1.
+        int l3_;
       };
 
       class thread_state : private thread_state_base {
@@ -572,12 +1155,14 @@ namespace exec {
           static_thread_pool_* pool,
           std::uint32_t index,
           bwos_params params,
-          const numa_policy& numa) noexcept
-          : thread_state_base(index, numa)
-          , local_queue_(
+          const numa_policy& numa,
+          const cpu_info* cpu) noexcept
+          : thread_state_base(index, numa, cpu)
+          , normalQueue_(
               params.numBlocks,
               params.blockSize,
-              numa_allocator<task_base*>(this->numa_node_))
+              numa_allocator<task_base*>(this->numa_node_),
+              params.layout)
           , state_(state::running)
           , pool_(pool) {
           std::random_device rd;
@@ -585,12 +1170,43 @@ namespace exec {
         }
 
         auto pop() -> pop_result;
-        void push_local(task_base* task);
+        void push_local(task_base* task, task_priority priority = task_priority::normal);
         void push_local(__intrusive_queue<&task_base::next>&& tasks);
 
+        void post_timer_command(timer_command* command) noexcept {
+          timer_commands_.push_front(command);
+        }
+
         auto notify() -> bool;
         void request_stop();
 
+        [[nodiscard]]
+        auto is_sleeping() const noexcept -> bool {
+          const state current = state_.load(std::memory_order_relaxed);
+          return current == state::sleeping || current == state::sleeping_until;
+        }
+
+        // The approximate number of tasks that batches handed to this worker and that it has
+        // not picked up yet.
+        [[nodiscard]]
+        auto queued_remote() const noexcept -> std::uint32_t {
+          return queuedRemote_.load(std::memory_order_relaxed);
+        }
+
+        void add_queued_remote(std::uint32_t n) noexcept {
+          queuedRemote_.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        // Takes the `n` tasks that a drain of the remote queues found off the count. Tasks that
+        // were queued without `add_queued_remote` can make `n` larger than the count.
+        void sub_queued_remote(std::uint32_t n) noexcept {
+          std::uint32_t current = queuedRemote_.load(std::memory_order_relaxed);
+          while (current != 0
+                 && !queuedRemote_.compare_exchange_weak(
+                   current, current > n ? current - n : 0, std::memory_order_relaxed)) {
+          }
+        }
+
         void victims(const std::vector<workstealing_victim>& victims) {
           for (workstealing_victim v: victims) {
             if (v.index() == index_) {
@@ -599,9 +1215,16 @@ namespace exec {
             }
             if (v.numa_node() == numa_node_) {
               near_victims_.push_back(v);
+              if (l3_ >= 0 && v.l3() == l3_) {
+                cache_victims_.push_back(v);
+              }
             }
             all_victims_.push_back(v);
           }
+          if (cache_victims_.size() == near_victims_.size()) {
+            // The whole node shares one L3 cache, there is nothing to prefer.
+            cache_victims_.clear();
+          }
         }
 
         [[nodiscard]]
@@ -615,7 +1238,17 @@ namespace exec {
         }
 
         auto as_victim() noexcept -> workstealing_victim {
-          return workstealing_victim{&local_queue_, index_, numa_node_};
+          return workstealing_victim{&normalQueue_, &highQueue_, index_, numa_node_, l3_};
+        }
+
+        [[nodiscard]]
+        auto counters() noexcept -> worker_counters& {
+          return counters_;
+        }
+
+        [[nodiscard]]
+        auto counters() const noexcept -> const worker_counters& {
+          return counters_;
         }
 
        private:
@@ -623,44 +1256,119 @@ namespace exec {
           running,
           stealing,
           sleeping,
+          // sleeping until the next timer deadline, woken up through `cv_`
+          sleeping_until,
           notified
         };
 
+        // The maximum number of `high` tasks in a row before a `normal` task is preferred.
+        static constexpr std::uint32_t maxHighInARow = 32;
+
+        auto lanes() noexcept -> std::array<task_priority, num_priorities>;
+        auto try_pop_lane(task_priority priority) -> pop_result;
+        auto try_remote_lane(task_priority priority) -> pop_result;
         auto try_pop() -> pop_result;
         auto try_remote() -> pop_result;
         auto try_steal(std::span<workstealing_victim> victims) -> pop_result;
         auto try_steal_near() -> pop_result;
         auto try_steal_any() -> pop_result;
+        auto try_spin() -> pop_result;
+
+        void process_timers();
+        void fire_timer(timer_base* timer, timer_base::completion how);
+
+        auto local_queue(task_priority priority) noexcept -> local_queue_t*;
+        auto make_local_queue(task_priority priority) noexcept -> local_queue_t*;
 
         void notify_one_sleeping();
         void set_stealing();
         void clear_stealing();
         void set_sleeping();
         void clear_sleeping();
-
-        bwos::lifo_queue<task_base*, numa_allocator<task_base*>> local_queue_;
-        __intrusive_queue<&task_base::next> pending_queue_{};
+        void note_idle();
+
+        local_queue_t normalQueue_;
+        // The BWOS queue of the `high` lane is created by the worker when the first `high` task
+        // reaches it, so that pools that never use priorities do not pay for it. `highQueue_`
+        // publishes it to the thieves.
+        std::optional<local_queue_t> highQueueStorage_{};
+        std::atomic<local_queue_t*> highQueue_{nullptr};
+        std::array<__intrusive_queue<&task_base::next>, num_priorities> pending_queues_{};
+        std::atomic<bool> stopRequested_{false};
+        timer_wheel<&timer_base::tick_, &timer_base::wheel_next_, &timer_base::wheel_pprev_>
+          timers_{};
+        __atomic_intrusive_queue<&timer_command::next_> timer_commands_{};
         std::mutex mut_{};
         std::condition_variable cv_{};
-        bool stopRequested_{false};
+        // The victims on the same NUMA node, and those of them that share the L3 cache.
+        std::vector<workstealing_victim> cache_victims_{};
         std::vector<workstealing_victim> near_victims_{};
         std::vector<workstealing_victim> all_victims_{};
         std::atomic<state> state_;
+        std::atomic<std::uint32_t> queuedRemote_{0};
         static_thread_pool_* pool_;
         xorshift rng_{};
+        // Recent fraction of spin phases that found work, in 1/65536 units.
+        std::uint32_t spinHitRate_{0};
+        // The number of times in a row this worker went to sleep while most workers were asleep.
+        std::uint32_t idleStreak_{0};
+        // The number of `high` tasks this worker took since it last considered `normal` ones.
+        std::uint32_t highInARow_{0};
+        STDEXEC_ATTRIBUTE(no_unique_address) worker_counters counters_ { };
       };
 
       void run(std::uint32_t index) noexcept;
       void join() noexcept;
 
+      [[nodiscard]]
+      auto limits_spread() const noexcept -> bool {
+        return spread_.minThreads < threadCount_;
+      }
+
+      [[nodiscard]]
+      auto is_bounded() const noexcept -> bool {
+        return backpressure_.capacity != 0;
+      }
+
+      auto try_acquire_slot() noexcept -> bool;
+      void release_slot() noexcept;
+      auto wait_for_slot(backpressure_waiter* waiter) noexcept -> bool;
+      auto cancel_wait(backpressure_waiter* waiter) noexcept -> bool;
+      void admit_waiters() noexcept;
+
+      void grow_if_saturated() noexcept;
+      void distribute(
+        remote_queue& queue,
+        __intrusive_queue<&task_base::next> tasks,
+        std::size_t tasks_size,
+        const nodemask& constraints) noexcept;
+
       alignas(64) std::atomic<std::uint32_t> numActive_{};
+      // Workers with an index below this number receive new work. Only used if `limits_spread()`.
+      std::atomic<std::uint32_t> activeThreads_{};
+      // Set once a scheduler for another than the `normal` lane was handed out. Until then the
+      // workers only look at the `normal` lane.
+      std::atomic<bool> usesPriorities_{false};
       alignas(64) remote_queue_list remotes_;
+      std::chrono::steady_clock::time_point timerEpoch_{std::chrono::steady_clock::now()};
       std::uint32_t threadCount_;
       std::uint32_t maxSteals_{threadCount_ + 1};
       bwos_params params_;
+      spin_params spin_;
+      bulk_params bulk_;
+      spread_params spread_;
+      affinity_params affinity_;
+      backpressure_params backpressure_;
+      // The slots of a bounded pool that are taken, and the operations that wait for one.
+      alignas(64) std::atomic<std::size_t> slotsTaken_{0};
+      std::atomic<std::size_t> numWaiters_{0};
+      std::mutex waitersMutex_{};
+      __intrusive_queue<&backpressure_waiter::next_> waiters_{};
       std::vector<std::thread> threads_;
       std::vector<std::optional<thread_state>> threadStates_;
       numa_policy numa_;
+      // The CPU of every worker. Empty unless the workers are pinned.
+      std::vector<cpu_info> workerCpus_;
 
       struct thread_index_by_numa_node {
         int numa_node;
@@ -698,15 +1406,41 @@ namespace exec {
       std::uint32_t threadCount,
       bwos_params params,
       numa_policy numa)
-      : remotes_(threadCount)
+      : static_thread_pool_(
+          threadCount,
+          static_thread_pool_options{.bwos = params, .numa = std::move(numa)}) {
+    }
+
+    inline static_thread_pool_::static_thread_pool_(
+      std::uint32_t threadCount,
+      static_thread_pool_options options)
+      : activeThreads_(threadCount)
+      , remotes_(threadCount)
       , threadCount_(threadCount)
-      , params_(params)
+      , params_(options.bwos)
+      , spin_(options.spin)
+      , bulk_(options.bulk)
+      , spread_(options.spread)
+      , affinity_(options.affinity)
+      , backpressure_(options.backpressure)
       , threadStates_(threadCount)
-      , numa_(std::move(numa)) {
+      , numa_(std::move(options.numa)) {
       STDEXEC_ASSERT(threadCount > 0);
+      if (spread_.minThreads == 0) {
+        spread_.minThreads = threadCount;
+      }
+      spread_.minThreads = (std::min) (spread_.minThreads, threadCount);
+
+      if (affinity_.placement != cpu_placement::none) {
+        const std::vector<cpu_info> cpus = cpu_topology::current().place(affinity_);
+        for (std::uint32_t index = 0; index < threadCount && !cpus.empty(); ++index) {
+          workerCpus_.push_back(cpus[index % cpus.size()]);
+        }
+      }
 
       for (std::uint32_t index = 0; index < threadCount; ++index) {
-        threadStates_[index].emplace(this, index, params, numa_);
+        threadStates_[index].emplace(
+          this, index, params_, numa_, workerCpus_.empty() ? nullptr : &workerCpus_[index]);
         threadIndexByNumaNode_.push_back(
           thread_index_by_numa_node{
             .numa_node = threadStates_[index]->numa_node(), .thread_index = index});
@@ -749,14 +1483,19 @@ namespace exec {
 
     inline void static_thread_pool_::run(std::uint32_t threadIndex) noexcept {
       STDEXEC_ASSERT(threadIndex < threadCount_);
+      this_worker() = this_worker_t{.pool_ = this, .index_ = threadIndex};
       // NOLINTNEXTLINE(bugprone-unused-return-value)
       numa_.bind_to_node(threadStates_[threadIndex]->numa_node());
+      if (!workerCpus_.empty()) {
+        pin_this_thread_to_cpu(workerCpus_[threadIndex].cpu);
+      }
       while (true) {
         // Make a blocking call to de-queue a task if we don't already have one.
         auto [task, queueIndex] = threadStates_[threadIndex]->pop();
         if (!task) {
           return; // pop() only returns null when request_stop() was called.
         }
+        threadStates_[threadIndex]->counters().increment(worker_counters::tasks_executed);
         task->__execute(task, queueIndex);
       }
     }
@@ -827,44 +1566,151 @@ namespace exec {
           targetIndex -= nThreads;
         }
       }
-      return targetIndex;
+      return targetIndex;
+    }
+
+    // Activates one more worker if work is queued or was just stolen while all active workers
+    // are busy.
+    inline void static_thread_pool_::grow_if_saturated() noexcept {
+      const std::uint32_t numActive = numActive_.load(std::memory_order_relaxed);
+      std::uint32_t limit = activeThreads_.load(std::memory_order_relaxed);
+      if ((numActive & 0xffffu) != 0 || (numActive >> 16u) < limit || limit == threadCount_) {
+        return;
+      }
+      if (activeThreads_.compare_exchange_strong(limit, limit + 1, std::memory_order_relaxed)) {
+        threadStates_[limit]->notify();
+      }
+    }
+
+    inline auto static_thread_pool_::try_acquire_slot() noexcept -> bool {
+      std::size_t taken = slotsTaken_.load(std::memory_order_seq_cst);
+      do {
+        if (taken >= backpressure_.capacity) {
+          return false;
+        }
+      } while (!slotsTaken_.compare_exchange_weak(taken, taken + 1, std::memory_order_seq_cst));
+      return true;
+    }
+
+    inline void static_thread_pool_::release_slot() noexcept {
+      slotsTaken_.fetch_sub(1, std::memory_order_seq_cst);
+      // Pairs with `wait_for_slot`: either this sees the new waiter or the waiter sees the slot.
+      if (numWaiters_.load(std::memory_order_seq_cst) != 0) {
+        admit_waiters();
+      }
+    }
+
+    // Returns false without queueing the waiter if `cancel_wait` was called for it already.
+    inline auto static_thread_pool_::wait_for_slot(backpressure_waiter* waiter) noexcept -> bool {
+      {
+        std::lock_guard lock{waitersMutex_};
+        if (waiter->cancelled_) {
+          return false;
+        }
+        waiters_.push_back(waiter);
+        numWaiters_.fetch_add(1, std::memory_order_seq_cst);
+      }
+      // A slot may have been released since the caller failed to acquire one.
+      admit_waiters();
+      return true;
+    }
+
+    // Unlinks a waiter whose stop was requested. Returns true if it was still queued, in which case
+    // the caller completes it. Otherwise it either was admitted already or is not queued yet, and
+    // `wait_for_slot` will refuse to queue it.
+    inline auto static_thread_pool_::cancel_wait(backpressure_waiter* waiter) noexcept -> bool {
+      std::lock_guard lock{waitersMutex_};
+      waiter->cancelled_ = true;
+      bool found = false;
+      __intrusive_queue<&backpressure_waiter::next_> rest{};
+      while (!waiters_.empty()) {
+        backpressure_waiter* queued = waiters_.pop_front();
+        if (queued == waiter) {
+          found = true;
+          numWaiters_.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+          rest.push_back(queued);
+        }
+      }
+      waiters_ = std::move(rest);
+      return found;
+    }
+
+    inline void static_thread_pool_::admit_waiters() noexcept {
+      __intrusive_queue<&backpressure_waiter::next_> admitted{};
+      {
+        std::lock_guard lock{waitersMutex_};
+        while (!waiters_.empty() && try_acquire_slot()) {
+          admitted.push_back(waiters_.pop_front());
+          numWaiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+      }
+      while (!admitted.empty()) {
+        backpressure_waiter* waiter = admitted.pop_front();
+        waiter->admit_(waiter);
+      }
     }
 
     inline void static_thread_pool_::enqueue(
       remote_queue& queue,
       task_base* task,
-      const nodemask& constraints) noexcept {
+      const nodemask& constraints,
+      task_priority priority) noexcept {
       static thread_local std::thread::id this_id = std::this_thread::get_id();
       remote_queue* correct_queue = this_id == queue.id_ ? &queue : get_remote_queue();
       std::size_t idx = correct_queue->index_;
       if (idx < threadStates_.size()) {
         auto this_node = static_cast<std::size_t>(threadStates_[idx]->numa_node());
         if (constraints[this_node]) {
-          threadStates_[idx]->push_local(task);
+          threadStates_[idx]->push_local(task, priority);
           return;
         }
       }
 
-      const std::size_t threadIndex = random_thread_index_with_constraints(constraints);
-      queue.queues_[threadIndex].push_front(task);
-      threadStates_[threadIndex]->notify();
+      std::size_t threadIndex = random_thread_index_with_constraints(constraints);
+      if (limits_spread()) {
+        // Prefer an active worker if it satisfies the constraints.
+        const std::size_t activeIndex = threadIndex % active_thread_count();
+        if (constraints[static_cast<std::size_t>(threadStates_[activeIndex]->numa_node())]) {
+          threadIndex = activeIndex;
+        }
+      }
+      queue.queue(threadIndex, priority).push_front(task);
+      if (!threadStates_[threadIndex]->notify() && limits_spread()) {
+        grow_if_saturated();
+      }
     }
 
     inline void static_thread_pool_::enqueue(
       remote_queue& queue,
       task_base* task,
-      std::size_t threadIndex) noexcept {
+      std::size_t threadIndex,
+      task_priority priority) noexcept {
       threadIndex %= threadCount_;
-      queue.queues_[threadIndex].push_front(task);
+      queue.queue(threadIndex, priority).push_front(task);
       threadStates_[threadIndex]->notify();
     }
 
     template <std::derived_from<task_base> TaskT>
     void static_thread_pool_::bulk_enqueue(TaskT* task, std::uint32_t n_threads) noexcept {
+      const this_worker_t& worker = this_worker();
       auto& queue = *this->get_remote_queue();
-      for (std::uint32_t i = 0; i < n_threads; ++i) {
-        std::uint32_t index = i % this->available_parallelism();
-        queue.queues_[index].push_front(task + i);
+      const std::uint32_t nQueues = (std::min) (n_threads, this->available_parallelism());
+      // Task `i` goes to queue `i % available_parallelism()`. Every queue receives its tasks
+      // as a single batch and its thread is notified once. A worker that starts the bulk
+      // operation keeps its own tasks in its BWOS queue.
+      for (std::uint32_t index = 0; index < nQueues; ++index) {
+        if (worker.pool_ == this && worker.index_ == index) {
+          for (std::uint32_t i = index; i < n_threads; i += this->available_parallelism()) {
+            threadStates_[index]->push_local(task + i);
+          }
+          continue;
+        }
+        __intrusive_queue<&task_base::next> tasks{};
+        for (std::uint32_t i = index; i < n_threads; i += this->available_parallelism()) {
+          tasks.push_back(task + i);
+        }
+        queue.queue(index).prepend(std::move(tasks));
         threadStates_[index]->notify();
       }
       // At this point the calling thread can exit and the pool will take over.
@@ -888,19 +1734,116 @@ namespace exec {
         }
       }
 
-      std::size_t nThreads = available_parallelism();
-      for (std::size_t i = 0; i < nThreads; ++i) {
-        auto [i0, iEnd] =
-          even_share(tasks_size, static_cast<std::uint32_t>(i), available_parallelism());
-        if (i0 == iEnd) {
+      distribute(*correct_queue, std::move(tasks), tasks_size, constraints);
+    }
+
+    // Tops up the queues of the target workers to a common level, so that workers with fewer
+    // queued tasks get more of the batch. The targets are the (active) workers that satisfy
+    // `constraints`. If a thief is active and some of these workers are awake, only the awake
+    // ones are targeted: the thieves spread the tasks further and wake up more workers as
+    // needed, see `clear_stealing`. This avoids waking up every worker for every batch.
+    inline void static_thread_pool_::distribute(
+      remote_queue& queue,
+      __intrusive_queue<&task_base::next> tasks,
+      std::size_t tasks_size,
+      const nodemask& constraints) noexcept {
+      if (tasks.empty()) {
+        return;
+      }
+      const std::uint32_t limit = limits_spread() ? active_thread_count() : threadCount_;
+      const bool hasThieves = (numActive_.load(std::memory_order_relaxed) & 0xffffu) != 0;
+      auto eligible = [&](std::uint32_t i) {
+        return i < limit && constraints[static_cast<std::size_t>(threadStates_[i]->numa_node())];
+      };
+      bool anyEligible = false;
+      bool anyAwake = false;
+      for (std::uint32_t i = 0; i < threadCount_; ++i) {
+        if (eligible(i)) {
+          anyEligible = true;
+          anyAwake = anyAwake || !threadStates_[i]->is_sleeping();
+        }
+      }
+      const bool onlyAwake = hasThieves && anyAwake;
+      auto is_target = [&](std::uint32_t i) {
+        if (!anyEligible) {
+          return true;
+        }
+        return eligible(i) && (!onlyAwake || !threadStates_[i]->is_sleeping());
+      };
+
+      // The lowest level such that topping up every target to it takes the whole batch.
+      auto capacity = [&](std::uint64_t level) {
+        std::uint64_t total = 0;
+        for (std::uint32_t i = 0; i < threadCount_; ++i) {
+          const std::uint64_t depth = threadStates_[i]->queued_remote();
+          if (is_target(i) && depth < level) {
+            total += level - depth;
+          }
+        }
+        return total;
+      };
+      std::uint64_t low = 0;
+      std::uint64_t high = std::uint64_t(std::numeric_limits<std::uint32_t>::max()) + tasks_size;
+      while (low < high) {
+        const std::uint64_t mid = low + (high - low) / 2;
+        if (capacity(mid) >= tasks_size) {
+          high = mid;
+        } else {
+          low = mid + 1;
+        }
+      }
+
+      std::uint32_t first = threadCount_;
+      for (std::uint32_t i = 0; i < threadCount_ && !tasks.empty(); ++i) {
+        if (!is_target(i)) {
           continue;
         }
+        first = (std::min) (first, i);
+        const std::uint64_t depth = threadStates_[i]->queued_remote();
+        std::uint64_t n = depth < low ? low - depth : 0;
         __intrusive_queue<&task_base::next> tmp{};
-        for (std::size_t j = i0; j < iEnd; ++j) {
+        std::uint32_t count = 0;
+        for (; n != 0 && !tasks.empty(); --n, ++count) {
           tmp.push_back(tasks.pop_front());
         }
-        correct_queue->queues_[i].prepend(std::move(tmp));
-        threadStates_[i]->notify();
+        if (count != 0) {
+          // Counted before they are published, so that the drain never takes them off first.
+          threadStates_[i]->add_queued_remote(count);
+          queue.queue(i).prepend(std::move(tmp));
+          threadStates_[i]->notify();
+        }
+      }
+      // The depths may have changed while the level was computed.
+      if (!tasks.empty()) {
+        first = first == threadCount_ ? 0 : first;
+        queue.queue(first).prepend(std::move(tasks));
+        threadStates_[first]->notify();
+      }
+    }
+
+    inline auto static_thread_pool_::pick_timer_owner() noexcept -> std::uint32_t {
+      const this_worker_t& worker = this_worker();
+      if (worker.pool_ == this) {
+        return worker.index_;
+      }
+      return static_cast<std::uint32_t>(
+        random_thread_index_with_constraints(nodemask::any()) % active_thread_count());
+    }
+
+    inline void static_thread_pool_::schedule_timer(timer_base* timer) noexcept {
+      const this_worker_t& worker = this_worker();
+      const std::uint32_t owner = timer->owner_;
+      threadStates_[owner]->post_timer_command(&timer->schedule_command_);
+      if (worker.pool_ != this || worker.index_ != owner) {
+        threadStates_[owner]->notify();
+      }
+    }
+
+    inline void static_thread_pool_::cancel_timer(timer_base* timer) noexcept {
+      const this_worker_t& worker = this_worker();
+      threadStates_[timer->owner_]->post_timer_command(&timer->stop_command_);
+      if (worker.pool_ != this || worker.index_ != timer->owner_) {
+        threadStates_[timer->owner_]->notify();
       }
     }
 
@@ -913,27 +1856,123 @@ namespace exec {
       tmp.clear();
     }
 
-    inline auto static_thread_pool_::thread_state::try_remote()
+    // Returns the local queue of `priority`, or null if the `high` one does not exist yet.
+    inline auto static_thread_pool_::thread_state::local_queue(task_priority priority) noexcept
+      -> local_queue_t* {
+      if (priority == task_priority::normal) {
+        return &normalQueue_;
+      }
+      return highQueue_.load(std::memory_order_relaxed);
+    }
+
+    // Returns the local queue of `priority` and creates the `high` one if needed. Returns null if
+    // that fails, in which case the tasks of the lane stay in its pending queue.
+    inline auto static_thread_pool_::thread_state::make_local_queue(task_priority priority) noexcept
+      -> local_queue_t* {
+      if (local_queue_t* queue = local_queue(priority)) {
+        return queue;
+      }
+      STDEXEC_TRY {
+        const bwos_params params = pool_->params();
+        highQueueStorage_.emplace(
+          params.numBlocks,
+          params.blockSize,
+          numa_allocator<task_base*>(this->numa_node_),
+          params.layout);
+      }
+      STDEXEC_CATCH_ALL {
+        return nullptr;
+      }
+      highQueue_.store(&*highQueueStorage_, std::memory_order_release);
+      return &*highQueueStorage_;
+    }
+
+    // The lanes in the order in which this worker looks at them. `normal` goes first whenever
+    // `maxHighInARow` `high` tasks were taken in a row.
+    inline auto static_thread_pool_::thread_state::lanes() noexcept
+      -> std::array<task_priority, num_priorities> {
+      if (highInARow_ >= maxHighInARow) {
+        highInARow_ = 0;
+        return {task_priority::normal, task_priority::high};
+      }
+      return {task_priority::high, task_priority::normal};
+    }
+
+    inline auto static_thread_pool_::thread_state::try_remote_lane(task_priority priority)
       -> static_thread_pool_::thread_state::pop_result {
       pop_result result{.task = nullptr, .queueIndex = index_};
-      __intrusive_queue<&task_base::next> remotes = pool_->remotes_.pop_all_reversed(index_);
-      pending_queue_.append(std::move(remotes));
-      if (!pending_queue_.empty()) {
-        move_pending_to_local(pending_queue_, local_queue_);
-        result.task = local_queue_.pop_back();
+      const auto lane = static_cast<std::size_t>(priority);
+      auto& pending_queue = pending_queues_[lane];
+      __intrusive_queue<&task_base::next> remotes =
+        pool_->remotes_.pop_all_reversed(index_, priority);
+      if (!remotes.empty() && queued_remote() != 0) {
+        std::uint32_t drained = 0;
+        for ([[maybe_unused]] task_base* task: remotes) {
+          ++drained;
+        }
+        sub_queued_remote(drained);
+      }
+      pending_queue.append(std::move(remotes));
+      if (!pending_queue.empty()) {
+        if (local_queue_t* queue = make_local_queue(priority)) {
+          move_pending_to_local(pending_queue, *queue);
+          if (!pending_queue.empty()) {
+            counters_.increment(worker_counters::pending_overflows);
+          }
+          result.task = queue->pop_back();
+        } else {
+          result.task = pending_queue.pop_front();
+        }
+        if (result.task) {
+          counters_.increment(worker_counters::remote_pops);
+        }
       }
 
       return result;
     }
 
-    inline auto static_thread_pool_::thread_state::try_pop()
+    inline auto static_thread_pool_::thread_state::try_pop_lane(task_priority priority)
       -> static_thread_pool_::thread_state::pop_result {
       pop_result result{.task = nullptr, .queueIndex = index_};
-      result.task = local_queue_.pop_back();
+      local_queue_t* queue = local_queue(priority);
+      result.task = queue ? queue->pop_back() : nullptr;
       if (result.task) [[likely]] {
+        counters_.increment(worker_counters::local_pops);
         return result;
       }
-      return try_remote();
+      return try_remote_lane(priority);
+    }
+
+    inline auto static_thread_pool_::thread_state::try_remote()
+      -> static_thread_pool_::thread_state::pop_result {
+      if (!pool_->usesPriorities_.load(std::memory_order_relaxed)) [[likely]] {
+        return try_remote_lane(task_priority::normal);
+      }
+      pop_result result{.task = nullptr, .queueIndex = index_};
+      for (task_priority priority: lanes()) {
+        result = try_remote_lane(priority);
+        if (result.task) {
+          highInARow_ = priority == task_priority::high ? highInARow_ + 1 : 0;
+          break;
+        }
+      }
+      return result;
+    }
+
+    inline auto static_thread_pool_::thread_state::try_pop()
+      -> static_thread_pool_::thread_state::pop_result {
+      if (!pool_->usesPriorities_.load(std::memory_order_relaxed)) [[likely]] {
+        return try_pop_lane(task_priority::normal);
+      }
+      pop_result result{.task = nullptr, .queueIndex = index_};
+      for (task_priority priority: lanes()) {
+        result = try_pop_lane(priority);
+        if (result.task) {
+          highInARow_ = priority == task_priority::high ? highInARow_ + 1 : 0;
+          break;
+        }
+      }
+      return result;
     }
 
     inline auto static_thread_pool_::thread_state::try_steal(std::span<workstealing_victim> victims)
@@ -941,32 +1980,70 @@ namespace exec {
       if (victims.empty()) {
         return {.task = nullptr, .queueIndex = index_};
       }
+      if (pool_->limits_spread()) {
+        // Victims are sorted by index, inactive workers do not get new work to steal.
+        const std::uint32_t limit = pool_->active_thread_count();
+        auto end = std::partition_point(
+          victims.begin(), victims.end(), [limit](const workstealing_victim& v) {
+            return v.index() < limit;
+          });
+        victims = victims.first(static_cast<std::size_t>(end - victims.begin()));
+        if (victims.empty()) {
+          return {.task = nullptr, .queueIndex = index_};
+        }
+      }
       std::uniform_int_distribution<std::uint32_t> dist(
         0, static_cast<std::uint32_t>(victims.size() - 1));
       std::uint32_t victimIndex = dist(rng_);
       auto& v = victims[victimIndex];
-      return {.task = v.try_steal(), .queueIndex = v.index()};
+      if (pool_->usesPriorities_.load(std::memory_order_relaxed)) {
+        if (task_base* task = v.try_steal(task_priority::high)) {
+          return {.task = task, .queueIndex = v.index()};
+        }
+      }
+      return {.task = v.try_steal(task_priority::normal), .queueIndex = v.index()};
     }
 
     inline auto static_thread_pool_::thread_state::try_steal_near()
       -> static_thread_pool_::thread_state::pop_result {
-      return try_steal(near_victims_);
+      counters_.increment(worker_counters::near_steal_attempts);
+      // Tasks of workers that share the L3 cache are likely still cached.
+      pop_result result = try_steal(cache_victims_);
+      if (!result.task) {
+        result = try_steal(near_victims_);
+      }
+      if (result.task) {
+        counters_.increment(worker_counters::near_steals);
+      }
+      return result;
     }
 
     inline auto static_thread_pool_::thread_state::try_steal_any()
       -> static_thread_pool_::thread_state::pop_result {
-      return try_steal(all_victims_);
+      counters_.increment(worker_counters::any_steal_attempts);
+      pop_result result = try_steal(all_victims_);
+      if (result.task) {
+        counters_.increment(worker_counters::any_steals);
+      }
+      return result;
     }
 
-    inline void static_thread_pool_::thread_state::push_local(task_base* task) {
-      if (!local_queue_.push_back(task)) {
-        pending_queue_.push_back(task);
+    inline void
+      static_thread_pool_::thread_state::push_local(task_base* task, task_priority priority) {
+      const auto lane = static_cast<std::size_t>(priority);
+      local_queue_t* queue = make_local_queue(priority);
+      if (!queue || !queue->push_back(task)) {
+        counters_.increment(worker_counters::pending_overflows);
+        pending_queues_[lane].push_back(task);
+      }
+      if (pool_->limits_spread()) {
+        pool_->grow_if_saturated();
       }
     }
 
     inline void
       static_thread_pool_::thread_state::push_local(__intrusive_queue<&task_base::next>&& tasks) {
-      pending_queue_.prepend(std::move(tasks));
+      pending_queues_[static_cast<std::size_t>(task_priority::normal)].prepend(std::move(tasks));
     }
 
     inline void static_thread_pool_::thread_state::set_sleeping() {
@@ -998,11 +2075,34 @@ namespace exec {
       }
     }
 
+    // Deactivates the worker with the highest active index once this worker keeps going to sleep
+    // while most of the other active workers are asleep as well. The deactivated worker finishes
+    // the work it already has and is not given new work.
+    inline void static_thread_pool_::thread_state::note_idle() {
+      const std::uint32_t numActive = pool_->numActive_.load(std::memory_order_relaxed);
+      std::uint32_t limit = pool_->activeThreads_.load(std::memory_order_relaxed);
+      // This worker is still counted as an awake victim.
+      const std::uint32_t numAwake = (numActive >> 16u) + (numActive & 0xffffu) - 1;
+      if (2 * numAwake >= limit) {
+        idleStreak_ = 0;
+        return;
+      }
+      if (++idleStreak_ < pool_->spread_.shrinkAfter) {
+        return;
+      }
+      idleStreak_ = 0;
+      if (limit > pool_->spread_.minThreads) {
+        pool_->activeThreads_
+          .compare_exchange_strong(limit, limit - 1, std::memory_order_relaxed);
+      }
+    }
+
     inline void static_thread_pool_::thread_state::notify_one_sleeping() {
-      std::uniform_int_distribution<std::uint32_t> dist(0, pool_->threadCount_ - 1);
+      const std::uint32_t numThreads = pool_->active_thread_count();
+      std::uniform_int_distribution<std::uint32_t> dist(0, numThreads - 1);
       std::uint32_t startIndex = dist(rng_);
-      for (std::uint32_t i = 0; i < pool_->threadCount_; ++i) {
-        std::uint32_t index = (startIndex + i) % pool_->threadCount_;
+      for (std::uint32_t i = 0; i < numThreads; ++i) {
+        std::uint32_t index = (startIndex + i) % numThreads;
         if (index == index_) {
           continue;
         }
@@ -1014,6 +2114,7 @@ namespace exec {
 
     inline auto
       static_thread_pool_::thread_state::pop() -> static_thread_pool_::thread_state::pop_result {
+      process_timers();
       pop_result result = try_pop();
       while (!result.task) {
         set_stealing();
@@ -1021,6 +2122,9 @@ namespace exec {
           result = try_steal_near();
           if (result.task) {
             clear_stealing();
+            if (pool_->limits_spread()) {
+              pool_->grow_if_saturated();
+            }
             return result;
           }
         }
@@ -1029,79 +2133,230 @@ namespace exec {
           result = try_steal_any();
           if (result.task) {
             clear_stealing();
+            if (pool_->limits_spread()) {
+              pool_->grow_if_saturated();
+            }
             return result;
           }
         }
-        std::this_thread::yield();
+        result = try_spin();
         clear_stealing();
+        if (result.task) {
+          return result;
+        }
 
-        std::unique_lock lock{mut_};
-        if (stopRequested_) {
+        if (stopRequested_.load(std::memory_order_acquire)) {
           return result;
         }
+        if (pool_->limits_spread()) {
+          note_idle();
+        }
+        // Workers without timers park on a futex, the others need a timed wait.
+        const state sleep_state = timers_.empty() ? state::sleeping : state::sleeping_until;
+        std::unique_lock lock{mut_, std::defer_lock};
+        if (sleep_state == state::sleeping_until) {
+          lock.lock();
+        }
         state expected = state::running;
-        if (state_.compare_exchange_weak(expected, state::sleeping, std::memory_order_relaxed)) {
+        if (state_.compare_exchange_strong(expected, sleep_state, std::memory_order_acq_rel)) {
           result = try_remote();
           if (result.task) {
+            state_.store(state::running, std::memory_order_relaxed);
+            return result;
+          }
+          if (stopRequested_.load(std::memory_order_acquire)) {
             return result;
           }
           set_sleeping();
-          cv_.wait(lock);
-          lock.unlock();
+          counters_.increment(worker_counters::sleeps);
+          if (sleep_state == state::sleeping) {
+            state_.wait(state::sleeping, std::memory_order_acquire);
+          } else {
+            const auto deadline = pool_->timerEpoch_ + timer_tick(timers_.next_tick());
+            cv_.wait_until(lock, deadline, [this] {
+              return state_.load(std::memory_order_acquire) != state::sleeping_until;
+            });
+            lock.unlock();
+          }
+          if (state_.load(std::memory_order_relaxed) == state::notified) {
+            counters_.increment(worker_counters::wakeups);
+          }
           clear_sleeping();
         }
         if (lock.owns_lock()) {
           lock.unlock();
         }
         state_.store(state::running, std::memory_order_relaxed);
+        process_timers();
         result = try_pop();
       }
       return result;
     }
 
+    // Arms newly submitted timers, cancels timers on request and fires expired timers.
+    // Fired timers are pushed to the local queue so that they complete like any other task.
+    inline void static_thread_pool_::thread_state::process_timers() {
+      if (timer_commands_.empty() && timers_.empty()) [[likely]] {
+        return;
+      }
+      __intrusive_queue<&timer_command::next_> commands = timer_commands_.pop_all_reversed();
+      while (!commands.empty()) {
+        timer_command* command = commands.pop_front();
+        timer_base* timer = command->timer_;
+        if (command == &timer->schedule_command_) {
+          const int count =
+            timer->ref_count_.fetch_or(timer_base::claimed_flag, std::memory_order_acq_rel);
+          if (timer_base::references(count) == 2) {
+            // The stop request came before the claim, so it did not post a stop command.
+            timer->ref_count_.fetch_sub(1, std::memory_order_relaxed);
+            fire_timer(timer, timer_base::completion::stopped);
+            continue;
+          }
+          timer->tick_ = pool_->to_tick(timer->deadline_);
+          if (timers_.insert(timer)) {
+            timer->state_ = timer_base::state::armed;
+          } else {
+            fire_timer(timer, timer_base::completion::value);
+          }
+          continue;
+        }
+        // A stop command is only posted for a claimed timer. It holds the second reference, so
+        // dropping it here is never the last one unless the timer has already completed.
+        switch (timer->state_) {
+        case timer_base::state::armed:
+          timers_.erase(timer);
+          timer->ref_count_.fetch_sub(1, std::memory_order_relaxed);
+          fire_timer(timer, timer_base::completion::stopped);
+          break;
+        case timer_base::state::fired:
+          if (
+            timer_base::references(timer->ref_count_.fetch_sub(1, std::memory_order_acq_rel))
+            == 1) {
+            fire_timer(timer, timer_base::completion::stopped_unreferenced);
+          }
+          break;
+        }
+      }
+      if (!timers_.empty()) {
+        timers_.advance(pool_->current_tick(), [this](timer_base* timer) {
+          fire_timer(timer, timer_base::completion::value);
+        });
+      }
+    }
+
+    inline void static_thread_pool_::thread_state::fire_timer(
+      timer_base* timer,
+      timer_base::completion how) {
+      timer->state_ = timer_base::state::fired;
+      timer->completion_ = how;
+      push_local(timer, timer->priority_);
+    }
+
+    // Looks for work for a bounded number of polling rounds before the caller parks.
+    // The budget grows while spinning keeps finding work and shrinks while it does not.
+    inline auto static_thread_pool_::thread_state::try_spin()
+      -> static_thread_pool_::thread_state::pop_result {
+      const spin_params& spin = pool_->spin_;
+      pop_result result{.task = nullptr, .queueIndex = index_};
+      if (spin.maxSpins == 0) {
+        return result;
+      }
+      const std::uint32_t minSpins = (std::min) (spin.minSpins, spin.maxSpins);
+      const std::uint32_t budget =
+        minSpins
+        + static_cast<std::uint32_t>(
+          (std::uint64_t(spin.maxSpins - minSpins) * spinHitRate_) >> 16u);
+      for (std::uint32_t i = 0; i < budget && !result.task; ++i) {
+        for (std::uint32_t j = 0; j < spin.pausesPerSpin; ++j) {
+          __spin_loop_pause();
+        }
+        // Remote submitters always notify their target, so only drain the remote queues
+        // when that happened.
+        if (
+          state_.load(std::memory_order_relaxed) == state::notified
+          && state_.exchange(state::running, std::memory_order_acquire) == state::notified) {
+          result = try_remote();
+        }
+        if (!result.task) {
+          result = try_steal_any();
+        }
+      }
+      // Exponentially weighted moving average over the last ~8 spin phases.
+      const std::uint32_t sample = result.task ? (1u << 16u) : 0u;
+      spinHitRate_ = static_cast<std::uint32_t>(
+        std::int64_t(spinHitRate_) + ((std::int64_t(sample) - std::int64_t(spinHitRate_)) >> 3));
+      return result;
+    }
+
     inline auto static_thread_pool_::thread_state::notify() -> bool {
-      if (state_.exchange(state::notified, std::memory_order_relaxed) == state::sleeping) {
+      switch (state_.exchange(state::notified, std::memory_order_acq_rel)) {
+      case state::sleeping:
+        state_.notify_one();
+        return true;
+      case state::sleeping_until:
         {
           std::lock_guard lock{mut_};
         }
         cv_.notify_one();
         return true;
+      default:
+        return false;
       }
-      return false;
     }
 
     inline void static_thread_pool_::thread_state::request_stop() {
-      {
-        std::lock_guard lock{mut_};
-        stopRequested_ = true;
-      }
-      cv_.notify_one();
+      stopRequested_.store(true, std::memory_order_release);
+      notify();
     }
 
     template <typename ReceiverId>
-    class static_thread_pool_::operation<ReceiverId>::__t : public task_base {
+    class static_thread_pool_::operation<ReceiverId>::__t
+      : public task_base
+      , private backpressure_waiter {
       using __id = operation;
       friend static_thread_pool_::scheduler::_sender;
 
+      struct on_stop {
+        __t& self_;
+
+        void operator()() const noexcept {
+          self_.cancel_wait();
+        }
+      };
+
+      using stop_token_t = stop_token_of_t<env_of_t<Receiver>>;
+      using stop_callback_t = stop_callback_for_t<stop_token_t, on_stop>;
+
       static_thread_pool_& pool_;
       remote_queue* queue_;
       Receiver rcvr_;
       std::size_t threadIndex_{};
       nodemask constraints_{};
+      task_priority priority_{};
+      // Whether this operation holds a slot of a bounded pool.
+      bool holdsSlot_{false};
+      // Registered while the operation waits for a slot of a bounded pool.
+      std::optional<stop_callback_t> on_stop_{};
 
       explicit __t(
         static_thread_pool_& pool,
         remote_queue* queue,
         Receiver rcvr,
         std::size_t tid,
-        const nodemask& constraints)
+        const nodemask& constraints,
+        task_priority priority = task_priority::normal)
         : pool_(pool)
         , queue_(queue)
         , rcvr_(static_cast<Receiver&&>(rcvr))
         , threadIndex_{tid}
-        , constraints_{constraints} {
+        , constraints_{constraints}
+        , priority_{priority} {
         this->__execute = [](task_base* t, const std::uint32_t /* tid */) noexcept {
           auto& op = *static_cast<__t*>(t);
+          op.on_stop_.reset();
+          if (op.holdsSlot_) {
+            op.pool_.release_slot();
+          }
           auto stoken = get_stop_token(get_env(op.rcvr_));
           if constexpr (stdexec::unstoppable_token<decltype(stoken)>) {
             stdexec::set_value(static_cast<Receiver&&>(op.rcvr_));
@@ -1117,22 +2372,122 @@ namespace exec {
 
       void enqueue_(task_base* op) const {
         if (threadIndex_ < pool_.available_parallelism()) {
-          pool_.enqueue(*queue_, op, threadIndex_);
+          pool_.enqueue(*queue_, op, threadIndex_, priority_);
         } else {
-          pool_.enqueue(*queue_, op, constraints_);
+          pool_.enqueue(*queue_, op, constraints_, priority_);
+        }
+      }
+
+      void cancel_wait() noexcept {
+        if (pool_.cancel_wait(this)) {
+          on_stop_.reset();
+          stdexec::set_stopped(static_cast<Receiver&&>(rcvr_));
         }
       }
 
      public:
       void start() & noexcept {
+        if (pool_.is_bounded() && this_worker().pool_ != &pool_) {
+          holdsSlot_ = true;
+          if (!pool_.try_acquire_slot()) {
+            if (pool_.backpressure().onFull == overflow_policy::stop) {
+              stdexec::set_stopped(static_cast<Receiver&&>(rcvr_));
+            } else {
+              this->admit_ = [](backpressure_waiter* waiter) noexcept {
+                auto* op = static_cast<__t*>(waiter);
+                op->enqueue_(op);
+              };
+              if constexpr (!unstoppable_token<stop_token_t>) {
+                on_stop_.emplace(get_stop_token(get_env(rcvr_)), on_stop{*this});
+              }
+              if (!pool_.wait_for_slot(this)) {
+                on_stop_.reset();
+                stdexec::set_stopped(static_cast<Receiver&&>(rcvr_));
+              }
+            }
+            return;
+          }
+        }
         enqueue_(this);
       }
     };
 
+    template <typename ReceiverId>
+    class static_thread_pool_::timer_operation<ReceiverId>::__t : private timer_base {
+      using __id = timer_operation;
+      friend static_thread_pool_::scheduler::_timer_sender;
+
+      struct on_stop {
+        __t& self_;
+
+        void operator()() const noexcept {
+          self_.request_stop();
+        }
+      };
+
+      using stop_callback_t = stop_callback_for_t<stop_token_of_t<env_of_t<Receiver>>, on_stop>;
+
+      static_thread_pool_& pool_;
+      timer_deadline when_;
+      Receiver rcvr_;
+      std::optional<stop_callback_t> on_stop_{};
+
+      explicit __t(
+        static_thread_pool_& pool,
+        timer_deadline when,
+        task_priority priority,
+        Receiver rcvr)
+        : timer_base{&complete}
+        , pool_(pool)
+        , when_(when)
+        , rcvr_(static_cast<Receiver&&>(rcvr)) {
+        this->priority_ = priority;
+      }
+
+      static void complete(timer_base* base, bool stopped) noexcept {
+        auto& op = *static_cast<__t*>(base);
+        op.on_stop_.reset();
+        if (stopped) {
+          stdexec::set_stopped(static_cast<Receiver&&>(op.rcvr_));
+        } else {
+          stdexec::set_value(static_cast<Receiver&&>(op.rcvr_));
+        }
+      }
+
+      void request_stop() noexcept {
+        // Before the owner claimed the timer it notices the stop request by itself.
+        if (
+          this->ref_count_.fetch_add(1, std::memory_order_acquire)
+          == (1 | timer_base::claimed_flag)) {
+          pool_.cancel_timer(this);
+        }
+      }
+
+     public:
+      void start() & noexcept {
+        this->deadline_ = when_.resolve();
+        this->owner_ = pool_.pick_timer_owner();
+        on_stop_.emplace(get_stop_token(stdexec::get_env(rcvr_)), on_stop{*this});
+        int expected = 0;
+        if (this->ref_count_.compare_exchange_strong(expected, 1, std::memory_order_release)) {
+          pool_.schedule_timer(this);
+        } else {
+          on_stop_.reset();
+          stdexec::set_stopped(static_cast<Receiver&&>(rcvr_));
+        }
+      }
+    };
+
     //////////////////////////////////////////////////////////////////////////////////////////////////
     // What follows is the implementation for parallel bulk execution on static_thread_pool_.
-    template <class SenderId, bool parallelize, std::integral Shape, class Fun>
-    struct static_thread_pool_::bulk_sender<SenderId, parallelize, Shape, Fun>::__t {
+    template <
+      class SenderId,
+      bool is_unchunked,
+      bool parallelize,
+      std::integral Shape,
+      class Fun
+    >
+    struct static_thread_pool_::bulk_sender<SenderId, is_unchunked, parallelize, Shape, Fun>::__t {
       using __id = bulk_sender;
       using sender_concept = sender_t;
 
@@ -1145,7 +2500,7 @@ namespace exec {
       using with_error_invoke_t = __if_c<
         __v<__value_types_t<
           __completion_signatures_of_t<Sender, Env...>,
-          __mbind_front_q<bulk_non_throwing, Fun, Shape>,
+          bulk_non_throwing_q<is_unchunked, Fun, Shape>,
           __q<__mand>
         >>,
         completion_signatures<>,
@@ -1163,9 +2518,14 @@ namespace exec {
       >;
 
       template <class Self, class Receiver>
-      using bulk_op_state_t = stdexec::__t<
-        bulk_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, parallelize, Shape, Fun>
-      >;
+      using bulk_op_state_t = stdexec::__t<bulk_op_state<
+        __cvref_id<Self, Sender>,
+        stdexec::__id<Receiver>,
+        is_unchunked,
+        parallelize,
+        Shape,
+        Fun
+      >>;
 
       template <__decays_to<__t> Self, receiver Receiver>
         requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
@@ -1195,10 +2555,28 @@ namespace exec {
       }
     };
 
+    //! The environment of the receivers that the pool connects on behalf of `rcvr`. It forwards
+    //! the environment of `rcvr` and provides an allocator for `node`, unless `rcvr` has an
+    //! allocator of its own. The operations capture `node` when they are connected, so that every
+    //! query of the environment yields the same allocator.
+    template <class Receiver>
+    auto get_pool_env(int node, const Receiver& rcvr) noexcept {
+      if constexpr (__callable<get_allocator_t, env_of_t<Receiver>>) {
+        return stdexec::get_env(rcvr);
+      } else {
+        return __env::__join(
+          prop{stdexec::get_allocator, node_allocator<std::byte>{node}}, stdexec::get_env(rcvr));
+      }
+    }
+
+    template <class Receiver>
+    using pool_env_t = decltype(get_pool_env(0, __declval<const Receiver&>()));
+
     //! The customized operation state for `stdexec::bulk` operations
     template <
       class CvrefSender,
       class Receiver,
+      bool is_unchunked,
       bool parallelize,
       class Shape,
       class Fun,
@@ -1209,19 +2587,42 @@ namespace exec {
       //! and its `__execute` function reads from that shared state.
       struct bulk_task : task_base {
         bulk_shared_state* sh_state_;
+        //! The rank of this execution agent in `[0, num_agents_required())`.
+        std::uint32_t index_{0};
 
         bulk_task(bulk_shared_state* sh_state)
           : sh_state_(sh_state) {
-          this->__execute = [](task_base* t, const std::uint32_t tid) noexcept {
+          this->__execute = [](task_base* t, const std::uint32_t /* tid */) noexcept {
             auto& sh_state = *static_cast<bulk_task*>(t)->sh_state_;
-            auto total_threads = sh_state.num_agents_required();
+            const std::uint32_t rank = static_cast<bulk_task*>(t)->index_;
+            auto total_threads = sh_state.num_agents_;
 
             auto computation = [&](auto&... args) {
               // Each computation does one or more call to the the bulk function.
               // In the case that the shape is much larger than the total number of threads,
               // then each call to computation will call the function many times.
-              auto [begin, end] = even_share(sh_state.shape_, tid, total_threads);
-              sh_state.fun_(begin, end, args...);
+              if constexpr (is_unchunked) {
+                // Each agent calls the function once per index of its share.
+                auto [begin, end] = even_share(sh_state.shape_, rank, total_threads);
+                for (; begin != end; ++begin) {
+                  sh_state.fun_(begin, args...);
+                }
+              } else if (sh_state.grain_size_ == 0) {
+                auto [begin, end] = even_share(sh_state.shape_, rank, total_threads);
+                sh_state.fun_(begin, end, args...);
+              } else {
+                // Keep claiming chunks until the shape is drained. Agents that get to run
+                // early or run fast take over the work of those that are delayed.
+                const std::uint64_t num_chunks = sh_state.num_chunks();
+                std::uint64_t chunk = sh_state.next_chunk_.fetch_add(1, std::memory_order_relaxed);
+                while (chunk < num_chunks) {
+                  const std::uint64_t begin = chunk * sh_state.grain_size_;
+                  const std::uint64_t end = (std::min) (
+                    begin + sh_state.grain_size_, static_cast<std::uint64_t>(sh_state.shape_));
+                  sh_state.fun_(static_cast<Shape>(begin), static_cast<Shape>(end), args...);
+                  chunk = sh_state.next_chunk_.fetch_add(1, std::memory_order_relaxed);
+                }
+              }
             };
 
             auto completion = [&](auto&... args) {
@@ -1236,9 +2637,13 @@ namespace exec {
                 std::uint32_t expected = total_threads;
 
                 if (sh_state.thread_with_exception_.compare_exchange_strong(
-                      expected, tid, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                      expected, rank, std::memory_order_relaxed, std::memory_order_relaxed)) {
                   sh_state.exception_ = std::current_exception();
                 }
+                if (sh_state.grain_size_ != 0) {
+                  // Don't hand out any more dynamic chunks.
+                  sh_state.next_chunk_.store(sh_state.num_chunks(), std::memory_order_relaxed);
+                }
               }
 
               const bool is_last_thread = sh_state.finished_threads_.fetch_add(1)
@@ -1278,24 +2683,62 @@ namespace exec {
       Receiver rcvr_;
       Shape shape_;
       Fun fun_;
+      //! The NUMA node of the allocator in the environment of the predecessor.
+      int node_;
+      std::uint32_t num_agents_;
 
       std::atomic<std::uint32_t> finished_threads_{0};
       std::atomic<std::uint32_t> thread_with_exception_{0};
       std::exception_ptr exception_;
-      std::vector<bulk_task> tasks_;
+      //! Allocated by the worker that runs the agents, on its NUMA node.
+      std::optional<std::vector<bulk_task, node_allocator<bulk_task>>> tasks_;
+      //! The number of indices per chunk in dynamic mode, or 0 for a static split.
+      std::uint64_t grain_size_{0};
+      alignas(64) std::atomic<std::uint64_t> next_chunk_{0};
+
+      //! The number of agents of a `bulk_unchunked` per thread of the pool. More agents than
+      //! threads let idle workers steal some of them when the indices take uneven time.
+      static constexpr std::uint32_t unchunked_agents_per_thread = 4;
 
       //! The number of agents required is the minimum of `shape_` and the available parallelism.
       //! That is, we don't need an agent for each of the shape values.
+      //! `bulk_unchunked` uses a few agents per thread, each of which calls the function for
+      //! every index of its share.
       [[nodiscard]]
       auto num_agents_required() const -> std::uint32_t {
-        if constexpr (parallelize) {
+        if constexpr (!parallelize) {
+          return static_cast<std::uint32_t>(1);
+        } else if constexpr (is_unchunked) {
+          return static_cast<std::uint32_t>((std::min) (
+            static_cast<std::uint64_t>(shape_),
+            std::uint64_t(pool_.available_parallelism()) * unchunked_agents_per_thread));
+        } else {
           return static_cast<std::uint32_t>(
             std::min(shape_, static_cast<Shape>(pool_.available_parallelism())));
-        } else {
-          return static_cast<std::uint32_t>(1);
         }
       }
 
+      [[nodiscard]]
+      auto num_chunks() const noexcept -> std::uint64_t {
+        return (static_cast<std::uint64_t>(shape_) + grain_size_ - 1) / grain_size_;
+      }
+
+      //! Returns the dynamic grain size configured for the pool, or 0 for a static split.
+      [[nodiscard]]
+      auto dynamic_grain_size() const noexcept -> std::uint64_t {
+        const bulk_params bulk = pool_.bulk();
+        if (
+          !parallelize || is_unchunked || bulk.chunking != bulk_chunking::dynamic
+          || shape_ == 0) {
+          return 0;
+        }
+        if (bulk.grainSize != 0) {
+          return bulk.grainSize;
+        }
+        const std::uint64_t num_chunks = std::uint64_t(num_agents_required()) * 8u;
+        return (std::max) (static_cast<std::uint64_t>(shape_) / num_chunks, std::uint64_t(1));
+      }
+
       template <class F>
       void apply(F f) {
         std::visit(
@@ -1310,14 +2753,34 @@ namespace exec {
       }
 
       //! Construct from a pool, receiver, shape, and function.
-      //! Allocates O(min(shape, available_parallelism())) memory.
       bulk_shared_state(static_thread_pool_& pool, Receiver rcvr, Shape shape, Fun fun)
         : pool_{pool}
         , rcvr_{static_cast<Receiver&&>(rcvr)}
         , shape_{shape}
         , fun_{fun}
-        , thread_with_exception_{num_agents_required()}
-        , tasks_{num_agents_required(), {this}} {
+        , node_{pool.calling_numa_node()}
+        , num_agents_{num_agents_required()}
+        , thread_with_exception_{num_agents_}
+        , grain_size_{dynamic_grain_size()} {
+      }
+
+      //! Allocates O(min(shape, available_parallelism())) agents on the NUMA node of the calling
+      //! worker and hands them to the pool.
+      void enqueue_agents() {
+        tasks_.emplace(num_agents_, bulk_task{this}, pool_.get_allocator<bulk_task>());
+        for (std::uint32_t i = 0; i < num_agents_; ++i) {
+          (*tasks_)[i].index_ = i;
+        }
+        pool_.bulk_enqueue(tasks_->data(), num_agents_);
+      }
+
+      //! Runs every index on the calling thread, for when the agents cannot be allocated and
+      //! the receiver does not accept an exception.
+      void run_inline() noexcept {
+        num_agents_ = 1;
+        thread_with_exception_.store(1, std::memory_order_relaxed);
+        bulk_task agent{this};
+        agent.__execute(&agent, 0);
       }
     };
 
@@ -1325,6 +2788,7 @@ namespace exec {
     template <
       class CvrefSenderId,
       class ReceiverId,
+      bool is_unchunked,
       bool parallelize,
       class Shape,
       class Fun,
@@ -1333,6 +2797,7 @@ namespace exec {
     struct static_thread_pool_::bulk_receiver<
       CvrefSenderId,
       ReceiverId,
+      is_unchunked,
       parallelize,
       Shape,
       Fun,
@@ -1342,13 +2807,22 @@ namespace exec {
       using receiver_concept = receiver_t;
 
       using shared_state =
-        bulk_shared_state<CvrefSender, Receiver, parallelize, Shape, Fun, MayThrow>;
+        bulk_shared_state<CvrefSender, Receiver, is_unchunked, parallelize, Shape, Fun, MayThrow>;
 
       shared_state& shared_state_;
 
       void enqueue() noexcept {
-        shared_state_.pool_
-          .bulk_enqueue(shared_state_.tasks_.data(), shared_state_.num_agents_required());
+        shared_state& state = shared_state_;
+        STDEXEC_TRY {
+          state.enqueue_agents();
+        }
+        STDEXEC_CATCH_ALL {
+          if constexpr (MayThrow) {
+            stdexec::set_error(static_cast<Receiver&&>(state.rcvr_), std::current_exception());
+          } else {
+            state.run_inline();
+          }
+        }
       }
 
       template <class... As>
@@ -1387,15 +2861,23 @@ namespace exec {
         stdexec::set_stopped(static_cast<Receiver&&>(state.rcvr_));
       }
 
-      auto get_env() const noexcept -> env_of_t<Receiver> {
-        return stdexec::get_env(shared_state_.rcvr_);
+      auto get_env() const noexcept -> pool_env_t<Receiver> {
+        return get_pool_env(shared_state_.node_, shared_state_.rcvr_);
       }
     };
 
-    template <class CvrefSenderId, class ReceiverId, bool parallelize, std::integral Shape, class Fun>
+    template <
+      class CvrefSenderId,
+      class ReceiverId,
+      bool is_unchunked,
+      bool parallelize,
+      std::integral Shape,
+      class Fun
+    >
     struct static_thread_pool_::bulk_op_state<
       CvrefSenderId,
       ReceiverId,
+      is_unchunked,
       parallelize,
       Shape,
       Fun
@@ -1405,13 +2887,14 @@ namespace exec {
       static constexpr bool may_throw = !__v<__value_types_of_t<
         CvrefSender,
         env_of_t<Receiver>,
-        __mbind_front_q<bulk_non_throwing, Fun, Shape>,
+        bulk_non_throwing_q<is_unchunked, Fun, Shape>,
         __q<__mand>
       >>;
 
-      using bulk_rcvr = bulk_receiver_t<CvrefSender, Receiver, parallelize, Shape, Fun, may_throw>;
+      using bulk_rcvr =
+        bulk_receiver_t<CvrefSender, Receiver, is_unchunked, parallelize, Shape, Fun, may_throw>;
       using shared_state =
-        bulk_shared_state<CvrefSender, Receiver, parallelize, Shape, Fun, may_throw>;
+        bulk_shared_state<CvrefSender, Receiver, is_unchunked, parallelize, Shape, Fun, may_throw>;
       using inner_op_state = connect_result_t<CvrefSender, bulk_rcvr>;
 
       shared_state shared_state_;
@@ -1431,22 +2914,19 @@ namespace exec {
 #if STDEXEC_HAS_STD_RANGES()
     namespace schedule_all_ {
       template <class Rcvr>
-      auto get_allocator(const Rcvr& rcvr) {
-        if constexpr (__callable<get_allocator_t, env_of_t<Rcvr>>) {
-          return get_allocator(get_env(rcvr));
-        } else {
-
-          return std::allocator<char>{};
-        }
+      auto get_allocator(int node, const Rcvr& rcvr) {
+        return stdexec::get_allocator(get_pool_env(node, rcvr));
       }
 
       template <class Receiver>
-      using allocator_of_t = decltype(get_allocator(__declval<Receiver>()));
+      using allocator_of_t = decltype(get_allocator(0, __declval<Receiver>()));
 
       template <class Range>
       struct operation_base {
         Range range_;
         static_thread_pool_& pool_;
+        //! The NUMA node of the allocator in the environment of the items.
+        int node_{pool_.calling_numa_node()};
         std::mutex start_mutex_{};
         bool has_started_{false};
         __intrusive_queue<&task_base::next> tasks_{};
@@ -1515,7 +2995,7 @@ namespace exec {
           };
 
           auto get_env() const noexcept -> env {
-            return {op_->pool_};
+            return {&op_->pool_};
           }
 
           template <receiver ItemReceiver>
@@ -1560,8 +3040,8 @@ namespace exec {
             }
           }
 
-          auto get_env() const noexcept -> env_of_t<Receiver> {
-            return stdexec::get_env(op_->rcvr_);
+          auto get_env() const noexcept -> pool_env_t<Receiver> {
+            return get_pool_env(op_->node_, op_->rcvr_);
           }
         };
       };
@@ -1581,7 +3061,8 @@ namespace exec {
             stdexec::__manual_lifetime<ItemOperation>
           >;
 
-          std::vector<__manual_lifetime<ItemOperation>, ItemAllocator> items_;
+          //! Allocated by the thread that starts the operation, on its NUMA node.
+          std::optional<std::vector<__manual_lifetime<ItemOperation>, ItemAllocator>> items_;
 
          public:
           using __id = operation;
@@ -1590,20 +3071,29 @@ namespace exec {
             : operation_base_with_receiver<
                 Range,
                 Receiver
-              >{std::move(range), pool, static_cast<Receiver&&>(rcvr)}
-            , items_(std::ranges::size(this->range_), ItemAllocator(get_allocator(this->rcvr_))) {
+              >{std::move(range), pool, static_cast<Receiver&&>(rcvr)} {
           }
 
           ~__t() {
             if (this->has_started_) {
-              for (auto& item: items_) {
+              for (auto& item: *items_) {
                 item.__destroy();
               }
             }
           }
 
           void start() & noexcept {
-            std::size_t size = items_.size();
+            STDEXEC_TRY {
+              items_.emplace(
+                std::ranges::size(this->range_),
+                ItemAllocator(get_allocator(this->pool_.calling_numa_node(), this->rcvr_)));
+            }
+            STDEXEC_CATCH_ALL {
+              stdexec::set_error(static_cast<Receiver&&>(this->rcvr_), std::current_exception());
+              return;
+            }
+            auto& items = *items_;
+            std::size_t size = items.size();
             std::size_t nthreads = this->pool_.available_parallelism();
             bwos_params params = this->pool_.params();
             std::size_t localSize = params.blockSize * params.numBlocks;
@@ -1613,11 +3103,11 @@ namespace exec {
             std::size_t i0 = 0;
             while (i0 + chunkSize < size) {
               for (std::size_t i = i0; i < i0 + chunkSize; ++i) {
-                items_[i].__construct_from([&] {
+                items[i].__construct_from([&] {
                   return stdexec::connect(
                     set_next(this->rcvr_, ItemSender{this, it + i}), NextReceiver{this});
                 });
-                stdexec::start(items_[i].__get());
+                stdexec::start(items[i].__get());
               }
 
               std::unique_lock lock{this->start_mutex_};
@@ -1626,11 +3116,11 @@ namespace exec {
               i0 += chunkSize;
             }
             for (std::size_t i = i0; i < size; ++i) {
-              items_[i].__construct_from([&] {
+              items[i].__construct_from([&] {
                 return stdexec::connect(
                   set_next(this->rcvr_, ItemSender{this, it + i}), NextReceiver{this});
               });
-              stdexec::start(items_[i].__get());
+              stdexec::start(items[i].__get());
             }
             std::unique_lock lock{this->start_mutex_};
             this->has_started_ = true;
@@ -1681,7 +3171,8 @@ namespace exec {
 #endif
   } // namespace _pool_
 
-  struct static_thread_pool : private _pool_::static_thread_pool_ {
+  struct STDEXEC_STATIC_THREAD_POOL_ABI_TAG static_thread_pool
+    : private _pool_::static_thread_pool_ {
 #if STDEXEC_HAS_STD_RANGES()
     friend struct _pool_::schedule_all_t;
 #endif
@@ -1696,6 +3187,10 @@ namespace exec {
       : _pool_::static_thread_pool_(threadCount, params, std::move(numa)) {
     }
 
+    static_thread_pool(std::uint32_t threadCount, static_thread_pool_options options)
+      : _pool_::static_thread_pool_(threadCount, std::move(options)) {
+    }
+
     // struct scheduler;
     using _pool_::static_thread_pool_::scheduler;
 
@@ -1716,6 +3211,37 @@ namespace exec {
 
     // bwos_params params() const;
     using _pool_::static_thread_pool_::params;
+
+    // spin_params spin() const;
+    using _pool_::static_thread_pool_::spin;
+
+    // bulk_params bulk() const;
+    using _pool_::static_thread_pool_::bulk;
+
+    // void enqueue_batch(
+    //   __intrusive_queue<&task_base::next> tasks,
+    //   std::size_t tasks_size,
+    //   const nodemask& constraints = nodemask::any()) noexcept;
+    using _pool_::static_thread_pool_::enqueue_batch;
+
+    // spread_params spread() const;
+    using _pool_::static_thread_pool_::spread;
+
+    // affinity_params affinity() const;
+    using _pool_::static_thread_pool_::affinity;
+
+    // backpressure_params backpressure() const;
+    using _pool_::static_thread_pool_::backpressure;
+
+    // std::uint32_t active_thread_count() const noexcept;
+    using _pool_::static_thread_pool_::active_thread_count;
+
+    // std::vector<thread_pool_worker_stats> stats() const;
+    using _pool_::static_thread_pool_::stats;
+
+    // template <class T = std::byte>
+    // node_allocator<T> get_allocator() const noexcept;
+    using _pool_::static_thread_pool_::get_allocator;
   };
 
 #if STDEXEC_HAS_STD_RANGES()
@@ -1732,4 +3258,6 @@ namespace exec {
   inline constexpr _pool_::schedule_all_t schedule_all{};
 #endif
 
+  static_assert(timed_scheduler<static_thread_pool::scheduler>);
+
 } // namespace exec
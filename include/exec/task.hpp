@@ -17,10 +17,14 @@
 
 #include <any>
 #include <cassert>
+#include <cstddef>
 #include <exception>
+#include <memory>
+#include <new>
 #include <utility>
 
 #include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__block_cache.hpp"
 #include "../stdexec/__detail/__meta.hpp"
 #include "../stdexec/__detail/__optional.hpp"
 #include "../stdexec/__detail/__variant.hpp"
@@ -255,6 +259,89 @@ namespace exec {
     using awaiter_context_t =
       __decay_t<env_of_t<_Promise>>::template awaiter_context_t<_Promise, _ParentPromise>;
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // Coroutine frame allocation
+    //
+    // Every frame is followed by a pointer to the function that releases it, so that the
+    // promise's operator delete can tell frames from the per-thread cache apart from frames
+    // that were allocated with an allocator passed via std::allocator_arg.
+    using __frame_dealloc_fn = void(void*, std::size_t) noexcept;
+
+    constexpr auto __round_up(std::size_t __n, std::size_t __align) noexcept -> std::size_t {
+      return (__n + __align - 1) & ~(__align - 1);
+    }
+
+    constexpr auto __frame_dealloc_offset(std::size_t __size) noexcept -> std::size_t {
+      return __round_up(__size, alignof(__frame_dealloc_fn*));
+    }
+
+    constexpr auto __frame_size_with_dealloc(std::size_t __size) noexcept -> std::size_t {
+      return __frame_dealloc_offset(__size) + sizeof(__frame_dealloc_fn*);
+    }
+
+    inline void __deallocate_cached_frame(void* __frame, std::size_t __size) noexcept {
+      stdexec::__block_cache::__deallocate(
+        __frame, __frame_size_with_dealloc(__size), __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    }
+
+    inline auto __allocate_cached_frame(std::size_t __size) -> void* {
+      void* __frame = stdexec::__block_cache::__allocate(
+        __frame_size_with_dealloc(__size), __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+      ::new (static_cast<char*>(__frame) + __frame_dealloc_offset(__size))
+        __frame_dealloc_fn*(&__deallocate_cached_frame);
+      return __frame;
+    }
+
+    // The unit in which frames are requested from a user-provided allocator.
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __frame_block {
+      std::byte __bytes_[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    // A copy of the allocator is stored after the pointer to the deallocation function.
+    template <class _BlockAlloc>
+    struct __allocator_frame_layout {
+      explicit constexpr __allocator_frame_layout(std::size_t __size) noexcept
+        : __alloc_offset_(__round_up(__frame_size_with_dealloc(__size), alignof(_BlockAlloc)))
+        , __num_blocks_(
+            (__alloc_offset_ + sizeof(_BlockAlloc) + sizeof(__frame_block) - 1)
+            / sizeof(__frame_block)) {
+      }
+
+      std::size_t __alloc_offset_;
+      std::size_t __num_blocks_;
+    };
+
+    template <class _BlockAlloc>
+    void __deallocate_allocator_frame(void* __frame, std::size_t __size) noexcept {
+      const __allocator_frame_layout<_BlockAlloc> __layout{__size};
+      auto* __stored = std::launder(
+        reinterpret_cast<_BlockAlloc*>(static_cast<char*>(__frame) + __layout.__alloc_offset_));
+      _BlockAlloc __alloc{std::move(*__stored)};
+      __stored->~_BlockAlloc();
+      std::allocator_traits<_BlockAlloc>::deallocate(
+        __alloc, static_cast<__frame_block*>(__frame), __layout.__num_blocks_);
+    }
+
+    template <class _Alloc>
+    auto __allocate_allocator_frame(std::size_t __size, const _Alloc& __alloc) -> void* {
+      using _BlockAlloc = std::allocator_traits<_Alloc>::template rebind_alloc<__frame_block>;
+      const __allocator_frame_layout<_BlockAlloc> __layout{__size};
+      _BlockAlloc __block_alloc{__alloc};
+      void* __frame = std::allocator_traits<_BlockAlloc>::allocate(
+        __block_alloc, __layout.__num_blocks_);
+      ::new (static_cast<char*>(__frame) + __frame_dealloc_offset(__size))
+        __frame_dealloc_fn*(&__deallocate_allocator_frame<_BlockAlloc>);
+      ::new (static_cast<char*>(__frame) + __layout.__alloc_offset_)
+        _BlockAlloc(std::move(__block_alloc));
+      return __frame;
+    }
+
+    inline void __deallocate_frame(void* __frame, std::size_t __size) noexcept {
+      __frame_dealloc_fn* __dealloc = *std::launder(reinterpret_cast<__frame_dealloc_fn**>(
+        static_cast<char*>(__frame) + __frame_dealloc_offset(__size)));
+      __dealloc(__frame, __size);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     // In a base class so it can be specialized when _Ty is void:
     template <class _Ty>
@@ -314,6 +401,101 @@ namespace exec {
       }
     };
 
+    template <class _Ty, class _Context>
+    class basic_task;
+
+    // A task with the default context inherits the scheduler of the coroutine that awaits it
+    // and finishes on that scheduler, so it can be resumed without a transition back.
+    template <class _Awaitable>
+    inline constexpr bool __is_sticky_task_v = false;
+
+    template <class _Ty>
+    inline constexpr bool __is_sticky_task_v<basic_task<_Ty, default_task_context<_Ty>>> = true;
+
+    template <class _Tag, class _Sender, class _Scheduler>
+    auto __completes_on_with(const _Sender& __sndr, const _Scheduler& __sched) noexcept -> bool {
+      if constexpr (__callable<get_completion_scheduler_t<_Tag>, env_of_t<const _Sender&>>) {
+        auto __completion_sched = get_completion_scheduler<_Tag>(stdexec::get_env(__sndr));
+        if constexpr (__same_as<decltype(__completion_sched), _Scheduler>) {
+          return __completion_sched == __sched;
+        } else if constexpr (__same_as<_Scheduler, __any_scheduler>) {
+          STDEXEC_TRY {
+            return __any_scheduler{std::move(__completion_sched)} == __sched;
+          }
+          STDEXEC_CATCH_ALL {
+            return false;
+          }
+        }
+      }
+      return false;
+    }
+
+    // Whether every completion of the sender happens on the given scheduler.
+    template <class _Sender, class _Env, class _Scheduler>
+    auto __completes_on(const _Sender& __sndr, const _Scheduler& __sched) noexcept -> bool {
+      return (!__sends<set_value_t, _Sender, _Env>
+              || __completes_on_with<set_value_t>(__sndr, __sched))
+          && (!__sends<set_error_t, _Sender, _Env>
+              || __completes_on_with<set_error_t>(__sndr, __sched))
+          && (!__sends<set_stopped_t, _Sender, _Env>
+              || __completes_on_with<set_stopped_t>(__sndr, __sched));
+    }
+
+    template <class _Awaiter, class _Promise>
+    auto __suspend(_Awaiter& __awaiter, __coro::coroutine_handle<_Promise> __h)
+      -> __coro::coroutine_handle<> {
+      using __result_t = decltype(__awaiter.await_suspend(__h));
+      if constexpr (std::is_void_v<__result_t>) {
+        __awaiter.await_suspend(__h);
+        return __coro::noop_coroutine();
+      } else if constexpr (__same_as<__result_t, bool>) {
+        return __awaiter.await_suspend(__h) ? __coro::noop_coroutine()
+                                            : __coro::coroutine_handle<>{__h};
+      } else {
+        return __awaiter.await_suspend(__h);
+      }
+    }
+
+    // Awaits a sender either directly or followed by a transition to the scheduler of the
+    // awaiting coroutine. The transition is skipped when the sender completes there anyway.
+    template <class _Direct, class _Rescheduled>
+    struct __affine_awaitable {
+      template <class _Sender, class _Promise, class _Scheduler>
+      __affine_awaitable(_Sender&& __sndr, _Promise& __promise, const _Scheduler& __sched) {
+        if (__task::__completes_on<__decay_t<_Sender>, env_of_t<_Promise&>>(__sndr, __sched)) {
+          __awaitables_.emplace_from([&] {
+            return stdexec::as_awaitable(static_cast<_Sender&&>(__sndr), __promise);
+          });
+        } else {
+          __awaitables_.emplace_from([&] {
+            return stdexec::as_awaitable(
+              continues_on(static_cast<_Sender&&>(__sndr), __sched), __promise);
+          });
+        }
+      }
+
+      auto await_ready() -> bool {
+        return __awaitables_.index() == 0 ? __awaitables_.template get<0>().await_ready()
+                                          : __awaitables_.template get<1>().await_ready();
+      }
+
+      template <class _Promise>
+      auto await_suspend(__coro::coroutine_handle<_Promise> __h) -> __coro::coroutine_handle<> {
+        return __awaitables_.index() == 0
+               ? __task::__suspend(__awaitables_.template get<0>(), __h)
+               : __task::__suspend(__awaitables_.template get<1>(), __h);
+      }
+
+      auto await_resume() -> decltype(__declval<_Direct&>().await_resume()) {
+        if (__awaitables_.index() == 0) {
+          return __awaitables_.template get<0>().await_resume();
+        }
+        return __awaitables_.template get<1>().await_resume();
+      }
+
+      __variant_for<_Direct, _Rescheduled> __awaitables_;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////
     // basic_task
     template <class _Ty, class _Context = default_task_context<_Ty>>
@@ -359,6 +541,36 @@ namespace exec {
         using __t = __promise;
         using __id = __promise;
 
+        // Frames come from a per-thread cache unless the coroutine takes an allocator as
+        // `std::allocator_arg, alloc` at the front of its parameters (after the object
+        // parameter of a member function).
+        static auto operator new(std::size_t __size) -> void* {
+          return __task::__allocate_cached_frame(__size);
+        }
+
+        template <class _Alloc, class... _Args>
+        static auto operator new(
+          std::size_t __size,
+          std::allocator_arg_t,
+          const _Alloc& __alloc,
+          const _Args&...) -> void* {
+          return __task::__allocate_allocator_frame(__size, __alloc);
+        }
+
+        template <class _Self, class _Alloc, class... _Args>
+        static auto operator new(
+          std::size_t __size,
+          const _Self&,
+          std::allocator_arg_t,
+          const _Alloc& __alloc,
+          const _Args&...) -> void* {
+          return __task::__allocate_allocator_frame(__size, __alloc);
+        }
+
+        static void operator delete(void* __frame, std::size_t __size) noexcept {
+          __task::__deallocate_frame(__frame, __size);
+        }
+
         auto get_return_object() noexcept -> basic_task {
           return basic_task(__coro::coroutine_handle<__promise>::from_promise(*this));
         }
@@ -391,11 +603,26 @@ namespace exec {
         template <sender _Awaitable>
           requires __scheduler_provider<_Context>
         auto await_transform(_Awaitable&& __awaitable) noexcept -> decltype(auto) {
-          // TODO: If we have a complete-where-it-starts query then we can optimize
-          // this to avoid the reschedule
-          return stdexec::as_awaitable(
-            continues_on(static_cast<_Awaitable&&>(__awaitable), get_scheduler(*__context_)),
-            *this);
+          auto&& __sched = get_scheduler(*__context_);
+          using __direct_t = __call_result_t<as_awaitable_t, _Awaitable, __promise&>;
+          using __rescheduled_t = __call_result_t<
+            as_awaitable_t,
+            __call_result_t<continues_on_t, _Awaitable, decltype(__sched)>,
+            __promise&
+          >;
+          if constexpr (
+            __is_sticky_task_v<__decay_t<_Awaitable>> || __is_scheduler_affine<_Awaitable>) {
+            // Nested tasks and senders that complete where they were started resume us on our
+            // scheduler. Nested tasks are resumed by symmetric transfer from their final suspend.
+            return stdexec::as_awaitable(static_cast<_Awaitable&&>(__awaitable), *this);
+          } else if constexpr (
+            std::is_object_v<__direct_t> && std::is_object_v<__rescheduled_t>) {
+            return __affine_awaitable<__direct_t, __rescheduled_t>{
+              static_cast<_Awaitable&&>(__awaitable), *this, __sched};
+          } else {
+            return stdexec::as_awaitable(
+              continues_on(static_cast<_Awaitable&&>(__awaitable), __sched), *this);
+          }
         }
 
         template <class _Scheduler>
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "__execution_fwd.hpp"
+
+#include "__concepts.hpp"
+#include "__env.hpp"
+#include "__scope.hpp"
+
+#include <memory>
+
+namespace stdexec {
+  template <class _Ty, class _Alloc>
+  using __rebind_alloc_t = std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+
+  // Allocates and constructs a `_Ty` with `__alloc`. The storage is released if the
+  // constructor throws.
+  template <class _Ty, class _Alloc, class... _Args>
+  auto __allocate_construct(const _Alloc& __alloc, _Args&&... __args) -> _Ty* {
+    using _TyAlloc = __rebind_alloc_t<_Ty, _Alloc>;
+    _TyAlloc __ty_alloc{__alloc};
+    _Ty* __p = std::allocator_traits<_TyAlloc>::allocate(__ty_alloc, 1);
+    __scope_guard __g{[&]() noexcept {
+      std::allocator_traits<_TyAlloc>::deallocate(__ty_alloc, __p, 1);
+    }};
+    std::allocator_traits<_TyAlloc>::construct(__ty_alloc, __p, static_cast<_Args&&>(__args)...);
+    __g.__dismiss();
+    return __p;
+  }
+
+  // Deletes a `_Ty` with the allocator in its environment `__env_`, or with `delete` if
+  // the environment has none. Pairs with `__allocate_construct`.
+  template <class _Ty>
+  struct __allocator_delete {
+    void operator()(_Ty* __p) const noexcept {
+      if constexpr (__callable<get_allocator_t, decltype((__p->__env_))>) {
+        // The allocator lives in *__p, so copy it out before destroying it.
+        auto __env_alloc = stdexec::get_allocator(__p->__env_);
+        using _TyAlloc = __rebind_alloc_t<_Ty, decltype(__env_alloc)>;
+        _TyAlloc __alloc{__env_alloc};
+        std::allocator_traits<_TyAlloc>::destroy(__alloc, __p);
+        std::allocator_traits<_TyAlloc>::deallocate(__alloc, __p, 1);
+      } else {
+        delete __p;
+      }
+    }
+  };
+} // namespace stdexec
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "__config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace stdexec {
+  // A per-thread cache of memory blocks in size classes of one cache line, for operation states
+  // and coroutine frames that are allocated and freed at a high rate.
+  //
+  // Every block goes back to the cache of the thread that allocated it. The owning thread keeps
+  // its free blocks in plain free lists; other threads push the blocks they free onto a
+  // lock-free stack of the owning cache, which the owner takes over as a whole when the free list
+  // of a size class runs empty. So a thread whose work completes on other threads still gets its
+  // blocks back. A cache lives until its thread has exited and all of its blocks are freed.
+  class __block_cache {
+   public:
+    static constexpr std::size_t __granularity = 64;
+    // Larger requests are passed through to the global heap, as are requests that need more
+    // than the default alignment of `operator new`.
+    static constexpr std::size_t __max_size = 2048;
+    // The number of blocks kept per size class and thread.
+    static constexpr std::size_t __max_blocks = 16;
+
+    static auto __allocate(std::size_t __size, std::size_t __align) -> void* {
+      if (!__recycles(__size, __align)) {
+        return ::operator new(__size, std::align_val_t{__align});
+      }
+      const std::size_t __index = __index_of(__size);
+      __block_cache* __cache = __this_thread(true);
+      if (__cache != nullptr) {
+        if (__header* __h = __cache->__pop(__index)) {
+          return __h + 1;
+        }
+      }
+      void* __raw = ::operator new(__size_of(__index), std::align_val_t{__granularity});
+      if (__cache != nullptr) {
+        __cache->__n_refs_.fetch_add(1, std::memory_order_relaxed);
+      }
+      return ::new (__raw) __header{{__cache}, __index} + 1;
+    }
+
+    static void __deallocate(void* __p, std::size_t __size, std::size_t __align) noexcept {
+      if (!__recycles(__size, __align)) {
+        ::operator delete(__p, std::align_val_t{__align});
+        return;
+      }
+      __header* __h = static_cast<__header*>(__p) - 1;
+      __block_cache* __owner = __h->__owner_;
+      if (__owner == nullptr) {
+        ::operator delete(static_cast<void*>(__h), std::align_val_t{__granularity});
+      } else if (__owner == __this_thread(false)) {
+        __owner->__push(__h);
+      } else {
+        __owner->__return(__h);
+      }
+    }
+
+   private:
+    // Precedes the memory that is handed out. While the block is free, it links to the next one.
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __header {
+      union {
+        __block_cache* __owner_;
+        __header* __next_;
+      };
+
+      std::size_t __index_;
+    };
+
+    struct __free_list {
+      __header* __head_{nullptr};
+      std::size_t __count_{0};
+    };
+
+    // Holds the cache of a thread and closes it when the thread exits.
+    struct __thread_ref {
+      __block_cache* __cache_{nullptr};
+
+      ~__thread_ref() {
+        __destroyed() = true;
+        if (__cache_ != nullptr) {
+          __cache_->__close();
+        }
+      }
+    };
+
+    __block_cache() = default;
+
+    static constexpr auto __recycles(std::size_t __size, std::size_t __align) noexcept -> bool {
+      return __size <= __max_size && __align <= alignof(__header);
+    }
+
+    static constexpr auto __index_of(std::size_t __size) noexcept -> std::size_t {
+      return (__size + sizeof(__header) - 1) / __granularity;
+    }
+
+    static constexpr auto __size_of(std::size_t __index) noexcept -> std::size_t {
+      return (__index + 1) * __granularity;
+    }
+
+    // Blocks can still be released by the destructors of other thread-local objects after the
+    // cache of the thread is closed. They are returned like the blocks of any other thread.
+    static auto __destroyed() noexcept -> bool& {
+      thread_local bool __flag = false;
+      return __flag;
+    }
+
+    static auto __this_thread(bool __create) -> __block_cache* {
+      if (__destroyed()) {
+        return nullptr;
+      }
+      thread_local __thread_ref __ref;
+      if (__ref.__cache_ == nullptr && __create) {
+        __ref.__cache_ = new __block_cache;
+      }
+      return __ref.__cache_;
+    }
+
+    // Marks the stack of returned blocks of a closed cache.
+    static auto __closed() noexcept -> __header* {
+      static __header __sentinel{};
+      return &__sentinel;
+    }
+
+    auto __pop(std::size_t __index) noexcept -> __header* {
+      __free_list& __list = __free_[__index];
+      if (__list.__head_ == nullptr) {
+        __take_returned();
+      }
+      __header* __h = __list.__head_;
+      if (__h != nullptr) {
+        __list.__head_ = __h->__next_;
+        --__list.__count_;
+        __h->__owner_ = this;
+      }
+      return __h;
+    }
+
+    void __push(__header* __h) noexcept {
+      __free_list& __list = __free_[__h->__index_];
+      if (__list.__count_ < __max_blocks) {
+        __h->__next_ = __list.__head_;
+        __list.__head_ = __h;
+        ++__list.__count_;
+      } else {
+        __delete(__h);
+      }
+    }
+
+    // Called by the owning thread to sort the blocks that other threads returned into the free
+    // lists.
+    void __take_returned() noexcept {
+      __header* __h = __returned_.exchange(nullptr, std::memory_order_acquire);
+      while (__h != nullptr) {
+        __header* __next = __h->__next_;
+        __push(__h);
+        __h = __next;
+      }
+    }
+
+    // Called by other threads. Once the owning thread has exited, the block goes to the heap.
+    void __return(__header* __h) noexcept {
+      __header* __head = __returned_.load(std::memory_order_relaxed);
+      do {
+        if (__head == __closed()) {
+          __delete(__h);
+          return;
+        }
+        __h->__next_ = __head;
+      } while (!__returned_.compare_exchange_weak(
+        __head, __h, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void __close() noexcept {
+      for (__free_list& __list: __free_) {
+        while (__header* __h = __list.__head_) {
+          __list.__head_ = __h->__next_;
+          __delete(__h);
+        }
+      }
+      __header* __h = __returned_.exchange(__closed(), std::memory_order_acquire);
+      while (__h != nullptr) {
+        __header* __next = __h->__next_;
+        __delete(__h);
+        __h = __next;
+      }
+      __release();
+    }
+
+    void __delete(__header* __h) noexcept {
+      ::operator delete(static_cast<void*>(__h), std::align_val_t{__granularity});
+      __release();
+    }
+
+    void __release() noexcept {
+      if (__n_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete this;
+      }
+    }
+
+    __free_list __free_[(__max_size + sizeof(__header) - 1) / __granularity + 1]{};
+    // Blocks that other threads freed, or `__closed()` after the owning thread exited.
+    std::atomic<__header*> __returned_{nullptr};
+    // One for every block of this cache that is not on the heap, plus one for the owning thread.
+    std::atomic<std::size_t> __n_refs_{1};
+  };
+} // namespace stdexec
@@ -18,12 +18,13 @@
 #include "__execution_fwd.hpp"
 
 // include these after __execution_fwd.hpp
+#include "__allocator.hpp"
 #include "__basic_sender.hpp"
 #include "__env.hpp"
-#include "__intrusive_slist.hpp"
 #include "__optional.hpp"
 #include "__meta.hpp"
 #include "__receivers.hpp"
+#include "__scope.hpp"
 #include "__transform_completion_signatures.hpp"
 #include "__tuple.hpp"
 #include "__variant.hpp" // IWYU pragma: keep
@@ -32,6 +33,7 @@
 
 #include <atomic>
 #include <exception>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -46,7 +48,7 @@
 //   started when one of the split senders is connected and started.
 //   split senders are copyable, so there are multiple operation states
 //   to be notified on completion. These are stored in an instrusive
-//   linked list.
+//   stack that is pushed to without taking a lock.
 //
 // ensure_started: the input async operation is always started, so
 //   the internal receiver will always be completed. The ensure_started
@@ -91,6 +93,67 @@ namespace stdexec::__shared {
     __local_state_base* __next_{};
   };
 
+  // The operation states waiting for the shared operation to complete. Waiters are pushed
+  // without taking a lock, and the completion closes the stack by swapping in a sentinel.
+  // Removing a waiter on a stop request is the slow path: it and closing take a lock so
+  // that a waiter is never unlinked while the completion walks the stack.
+  class __waiter_stack : __immovable {
+   public:
+    // Returns false if the stack is already closed.
+    auto __try_push(__local_state_base* __waiter) noexcept -> bool {
+      __local_state_base* __head = __head_.load(std::memory_order_acquire);
+      do {
+        if (__head == &__closed_) {
+          return false;
+        }
+        __waiter->__next_ = __head;
+      } while (!__head_.compare_exchange_weak(
+        __head, __waiter, std::memory_order_acq_rel, std::memory_order_acquire));
+      return true;
+    }
+
+    // Returns true if `__waiter` was found in the stack and unlinked.
+    auto __remove(__local_state_base* __waiter) noexcept -> bool {
+      std::lock_guard __lock{__mutex_};
+      __local_state_base* __head = __head_.load(std::memory_order_acquire);
+      if (__head == &__closed_) {
+        return false;
+      }
+      // Concurrent pushes only ever replace the head, so only unlinking the head needs a CAS.
+      if (
+        __head == __waiter
+        && __head_.compare_exchange_strong(
+          __head, __waiter->__next_, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return true;
+      }
+      for (__local_state_base* __prev = __head; __prev != nullptr; __prev = __prev->__next_) {
+        if (__prev->__next_ == __waiter) {
+          __prev->__next_ = __waiter->__next_;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Closes the stack. Returns the waiters in it, the most recent one first.
+    auto __close() noexcept -> __local_state_base* {
+      std::lock_guard __lock{__mutex_};
+      __local_state_base* __head = __head_.exchange(&__closed_, std::memory_order_acq_rel);
+      STDEXEC_ASSERT(__head != &__closed_);
+      return __head;
+    }
+
+    [[nodiscard]]
+    auto __closed() const noexcept -> bool {
+      return __head_.load(std::memory_order_acquire) == &__closed_;
+    }
+
+   private:
+    std::atomic<__local_state_base*> __head_{nullptr};
+    std::mutex __mutex_;
+    __local_state_base __closed_{};
+  };
+
   template <class _CvrefSender, class _Env>
   struct __shared_state;
 
@@ -121,23 +184,27 @@ namespace stdexec::__shared {
     void operator()() noexcept {
       // We reach here when a split/ensure_started sender has received a stop request from the
       // receiver to which it is connected.
-      if (std::unique_lock __lock{__sh_state_->__mutex_}) {
-        // Remove this operation from the waiters list. Removal can fail if:
-        //   1. It was already removed by another thread, or
-        //   2. It hasn't been added yet (see `start` below), or
-        //   3. The underlying operation has already completed.
-
-        // In each case, the right thing to do is nothing. If (1) then we raced with another
-        // thread and lost. In that case, the other thread will take care of it. If (2) then
-        // `start` will take care of it. If (3) then this stop request is safe to ignore.
-        if (!__sh_state_->__waiters_.remove(this))
-          return;
+
+      // Pairs with the fence in __shared_state::__try_add_waiter: either that sees the stop
+      // request, or the removal below sees the waiter.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      // Remove this operation from the waiters list. Removal can fail if:
+      //   1. It was already removed by another thread, or
+      //   2. It hasn't been added yet (see `start` below), or
+      //   3. The underlying operation has already completed.
+
+      // In each case, the right thing to do is nothing. If (1) then we raced with another
+      // thread and lost. In that case, the other thread will take care of it. If (2) then
+      // `start` will take care of it. If (3) then this stop request is safe to ignore.
+      if (!__sh_state_->__waiters_.__remove(this)) {
+        return;
       }
 
       // The following code and the __notify function cannot both execute. This is because the
       // __notify function is called from the shared state's __notify_waiters function, which
-      // first sets __waiters_ to the completed state. As a result, the attempt to remove `this`
-      // from the waiters list above will fail and this stop request is ignored.
+      // first closes __waiters_. As a result, the attempt to remove `this` from the waiters
+      // list above will fail and this stop request is ignored.
       std::exchange(__sh_state_, nullptr)->__detach();
       stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver()));
     }
@@ -211,7 +278,6 @@ namespace stdexec::__shared {
   template <class _CvrefSender, class _Env>
   struct __shared_state {
     using __receiver_t = __t<__receiver<__cvref_id<_CvrefSender>, __id<_Env>>>;
-    using __waiters_list_t = __intrusive_slist<&__local_state_base::__next_>;
 
     using __variant_t = __transform_completion_signatures<
       __completion_signatures_of_t<_CvrefSender, _Env>,
@@ -225,12 +291,10 @@ namespace stdexec::__shared {
     inplace_stop_source __stop_source_{};
     __env_t<_Env> __env_;
     __variant_t __results_{}; // Defaults to the "set_stopped" state
-    std::mutex __mutex_;      // This mutex guards access to __waiters_.
-    __waiters_list_t __waiters_{};
+    __waiter_stack __waiters_{};
     connect_result_t<_CvrefSender, __receiver_t> __shared_op_;
     std::atomic_flag __started_{};
     std::atomic<std::size_t> __ref_count_{2};
-    __local_state_base __tombstone_{};
 
     // Let a "consumer" be either a split/ensure_started sender, or an operation
     // state created by connecting a split/ensure_started sender to a receiver.
@@ -254,7 +318,7 @@ namespace stdexec::__shared {
 
     void __dec_ref() noexcept {
       if (2ul == __ref_count_.fetch_sub(2ul, std::memory_order_acq_rel)) {
-        delete this;
+        __destroy();
       }
     }
 
@@ -268,10 +332,15 @@ namespace stdexec::__shared {
 
     void __set_completed() noexcept {
       if (1ul == __ref_count_.fetch_sub(1ul, std::memory_order_acq_rel)) {
-        delete this;
+        __destroy();
       }
     }
 
+    // Deletes the shared state with the allocator it was created with, see __make_shared_state.
+    void __destroy() noexcept {
+      __allocator_delete<__shared_state>{}(this);
+    }
+
     void __detach() noexcept {
       if (__ref_count_.load() < 4ul) {
         // We are the final "consumer", and we are about to release our reference
@@ -282,7 +351,7 @@ namespace stdexec::__shared {
     }
 
     /// @post The "is running" bit is set in the shared state's ref count, OR the __waiters_ list
-    /// is set to the known "tombstone" value indicating completion.
+    /// is closed, indicating completion.
     void __try_start() noexcept {
       // With the split algorithm, multiple split senders can be started simultaneously, but
       // only one should start the shared async operation. If the low bit is set, then
@@ -292,7 +361,7 @@ namespace stdexec::__shared {
         if (__stop_source_.stop_requested()) {
           // Stop has already been requested. Rather than starting the operation, complete with
           // set_stopped immediately.
-          // 1. Sets __waiters_ to a known "tombstone" value.
+          // 1. Closes __waiters_.
           // 2. Notifies all the waiters that the operation has stopped.
           // 3. Sets the "is running" bit in the ref count to 0.
           __notify_waiters();
@@ -304,24 +373,24 @@ namespace stdexec::__shared {
 
     template <class _StopToken>
     auto __try_add_waiter(__local_state_base* __waiter, _StopToken __stok) noexcept -> bool {
-      std::unique_lock __lock{__mutex_};
-      if (__waiters_.front() == &__tombstone_) {
+      if (!__stok.stop_requested() && __waiters_.__try_push(__waiter)) {
+        // A stop request that arrived before the push could not find the waiter to remove it,
+        // so look again. If the removal fails, the stop callback or the completion of the
+        // shared operation has taken over the waiter.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return !__stok.stop_requested() || !__waiters_.__remove(__waiter);
+      } else if (__waiters_.__closed()) {
         // The work has already completed. Notify the waiter immediately.
-        __lock.unlock();
         __waiter->__notify();
         return true;
-      } else if (__stok.stop_requested()) {
+      } else {
         // Stop has been requested. Do not add the waiter.
         return false;
-      } else {
-        // Add the waiter to the list.
-        __waiters_.push_front(__waiter);
-        return true;
       }
     }
 
     /// @brief This is called when the shared async operation completes.
-    /// @post __waiters_ is set to a known "tombstone" value.
+    /// @post __waiters_ is closed.
     template <class _Tag, class... _As>
     void __complete(_Tag, _As&&... __as) noexcept {
       STDEXEC_TRY {
@@ -337,25 +406,14 @@ namespace stdexec::__shared {
     }
 
     /// @brief This is called when the shared async operation completes.
-    /// @post __waiters_ is set to a known "tombstone" value.
+    /// @post __waiters_ is closed.
     void __notify_waiters() noexcept {
-      __waiters_list_t __waiters_copy{&__tombstone_};
-
-      // Set the waiters list to a known "tombstone" value that we can check later.
-      {
-        std::lock_guard __lock{__mutex_};
-        __waiters_.swap(__waiters_copy);
-      }
-
-      STDEXEC_ASSERT(__waiters_copy.front() != &__tombstone_);
-      for (auto __itr = __waiters_copy.begin(); __itr != __waiters_copy.end();) {
-        __local_state_base* __item = *__itr;
-
-        // We must increment the iterator before calling notify, since notify may end up
-        // triggering *__item to be destructed on another thread, and the intrusive slist's
-        // iterator increment relies on __item.
-        ++__itr;
+      for (__local_state_base* __item = __waiters_.__close(); __item != nullptr;) {
+        // We must advance before calling notify, since notify may end up triggering *__item
+        // to be destructed on another thread.
+        __local_state_base* __next = __item->__next_;
         __item->__notify();
+        __item = __next;
       }
 
       // Set the "is running" bit in the ref count to zero. Delete the shared state if the
@@ -367,6 +425,22 @@ namespace stdexec::__shared {
   template <class _CvrefSender, class _Env>
   __shared_state(_CvrefSender&&, _Env) -> __shared_state<_CvrefSender, _Env>;
 
+  // Creates the shared state with the allocator of `__env`, if it has one. The shared state
+  // starts life with a ref-count of one.
+  template <class _CvrefSender, class _Env>
+  auto __make_shared_state(_CvrefSender&& __sndr, _Env&& __env)
+    -> __shared_state<_CvrefSender, __decay_t<_Env>>* {
+    using __sh_state_t = __shared_state<_CvrefSender, __decay_t<_Env>>;
+    if constexpr (__callable<get_allocator_t, const _Env&>) {
+      return __allocate_construct<__sh_state_t>(
+        stdexec::get_allocator(__env),
+        static_cast<_CvrefSender&&>(__sndr),
+        static_cast<_Env&&>(__env));
+    } else {
+      return new __sh_state_t{static_cast<_CvrefSender&&>(__sndr), static_cast<_Env&&>(__env)};
+    }
+  }
+
   template <class _Cvref, class _CvrefSender, class _Env>
   using __make_completions = __try_make_completion_signatures<
     // NOT TO SPEC:
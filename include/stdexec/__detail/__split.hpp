@@ -63,7 +63,7 @@ namespace stdexec {
           [&]<class _Env, class _Child>(__ignore, _Env&& __env, _Child&& __child) {
             // The shared state starts life with a ref-count of one.
             auto* __sh_state =
-              new __shared_state{static_cast<_Child&&>(__child), static_cast<_Env&&>(__env)};
+              __make_shared_state(static_cast<_Child&&>(__child), static_cast<_Env&&>(__env));
 
             return __make_sexpr<__split_t>(__box{__split_t(), __sh_state});
           });
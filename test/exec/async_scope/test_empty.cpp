@@ -1,8 +1,11 @@
 #include <catch2/catch.hpp>
 #include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
 
+#include <atomic>
+
 namespace ex = stdexec;
 using exec::async_scope;
 using stdexec::sync_wait;
@@ -171,4 +174,39 @@ namespace {
     REQUIRE(is_empty2);
   }
 #endif
+
+  TEST_CASE("sharded async_scope is empty only after all work is done", "[async_scope][empty]") {
+    exec::static_thread_pool pool{4};
+    using scheduler_t = decltype(pool.get_scheduler());
+    async_scope scope{GENERATE(std::size_t{1}, std::size_t{8})};
+    std::atomic<int> done{0};
+
+    // Every link of a chain spawns the next one from a worker before it completes, so the
+    // scope never becomes empty before the last link is done.
+    struct link {
+      async_scope* scope_;
+      scheduler_t sch_;
+      std::atomic<int>* done_;
+      int remaining_;
+
+      void operator()() const {
+        if (remaining_ > 1) {
+          scope_->spawn(ex::schedule(sch_) | ex::then(link{scope_, sch_, done_, remaining_ - 1}));
+        }
+        ++*done_;
+      }
+    };
+
+    constexpr int num_chains = 32;
+    constexpr int chain_length = 40;
+    for (int round = 1; round <= 3; ++round) {
+      for (int i = 0; i < num_chains; ++i) {
+        scope.spawn(
+          ex::schedule(pool.get_scheduler())
+          | ex::then(link{&scope, pool.get_scheduler(), &done, chain_length}));
+      }
+      sync_wait(scope.on_empty());
+      CHECK(done == round * num_chains * chain_length);
+    }
+  }
 } // namespace
@@ -1,8 +1,16 @@
 #include <catch2/catch.hpp>
 #include <exec/async_scope.hpp>
+#include <exec/single_thread_context.hpp>
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
 #include "test_common/type_helpers.hpp"
+#include "test_common/allocators.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -224,4 +232,136 @@ namespace {
     // TODO: reenable this
     // REQUIRE(P2519::__scope::empty(scope));
   }
+
+  TEST_CASE(
+    "spawn allocates the operation state with the allocator of the env",
+    "[async_scope][spawn]") {
+    impulse_scheduler sch;
+    bool executed{false};
+    async_scope scope;
+    allocation_counts counts;
+
+    scope.spawn(
+      ex::starts_on(sch, ex::just() | ex::then([&] { executed = true; })),
+      ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+    CHECK(counts.allocations == 1);
+    CHECK(counts.alive == 1);
+    sch.start_next();
+    CHECK(executed);
+    CHECK(counts.alive == 0);
+
+    // Synchronous completions release the operation state before spawn returns.
+    scope.spawn(ex::just(), ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+    CHECK(counts.allocations == 2);
+    CHECK(counts.alive == 0);
+  }
+
+  using recycling_allocator_t =
+    decltype(std::declval<const async_scope&>().get_recycling_allocator());
+
+  //! Forwards to the recycling allocator of a scope and remembers the last block it handed out.
+  template <class T>
+  struct recording_allocator {
+    using value_type = T;
+
+    explicit recording_allocator(void** last) noexcept
+      : last_(last) {
+    }
+
+    template <class U>
+    recording_allocator(const recording_allocator<U>& other) noexcept
+      : last_(other.last_) {
+    }
+
+    auto allocate(std::size_t n) -> T* {
+      T* p = inner_t{}.allocate(n);
+      *last_ = p;
+      return p;
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      inner_t{}.deallocate(p, n);
+    }
+
+    template <class U>
+    auto operator==(const recording_allocator<U>& other) const noexcept -> bool {
+      return last_ == other.last_;
+    }
+
+    using inner_t = std::allocator_traits<recycling_allocator_t>::rebind_alloc<T>;
+    void** last_;
+  };
+
+  TEST_CASE("spawn reuses operation states with the recycling allocator", "[async_scope][spawn]") {
+    impulse_scheduler sch;
+    int executed{0};
+    async_scope scope;
+    auto alloc = scope.get_recycling_allocator();
+    CHECK(alloc == scope.get_recycling_allocator());
+
+    // The operation state of a completed spawn is handed to the next one of the same size.
+    void* last = nullptr;
+    recording_allocator<std::byte> recording{&last};
+    auto spawn = [&] {
+      scope.spawn(
+        ex::starts_on(sch, ex::just() | ex::then([&] { ++executed; })),
+        ex::prop{ex::get_allocator, recording});
+    };
+    spawn();
+    void* spawned = last;
+    REQUIRE(spawned != nullptr);
+    sch.start_next();
+    CHECK(executed == 1);
+    last = nullptr;
+    spawn();
+    CHECK(last == spawned);
+
+    // While the first operation is alive, the next one gets a different block.
+    spawn();
+    CHECK(last != spawned);
+    sch.start_next();
+    sch.start_next();
+    CHECK(executed == 3);
+
+    // Blocks of the same size class are handed out again, larger ones are not recycled.
+    using block = std::array<std::byte, 200>;
+    std::allocator_traits<decltype(alloc)>::rebind_alloc<block> block_alloc{alloc};
+    block* first = block_alloc.allocate(1);
+    block_alloc.deallocate(first, 1);
+    block* second = block_alloc.allocate(1);
+    CHECK(second == first);
+    block_alloc.deallocate(second, 1);
+
+    using large_block = std::array<std::byte, 4096>;
+    std::allocator_traits<decltype(alloc)>::rebind_alloc<large_block> large_alloc{alloc};
+    large_alloc.deallocate(large_alloc.allocate(1), 1);
+  }
+
+  TEST_CASE(
+    "spawn reuses operation states that complete on another thread",
+    "[async_scope][spawn]") {
+    exec::single_thread_context ctx;
+    async_scope scope;
+    void* last = nullptr;
+    recording_allocator<std::byte> recording{&last};
+    auto spawn = [&] {
+      scope.spawn(
+        ex::starts_on(ctx.get_scheduler(), ex::just()), ex::prop{ex::get_allocator, recording});
+    };
+
+    // A fresh thread spawns, the operations complete and free their blocks on `ctx`.
+    void* spawned = nullptr;
+    void* respawned = nullptr;
+    std::thread spawner{[&] {
+      spawn();
+      spawned = last;
+      sync_wait(scope.on_empty());
+      spawn();
+      respawned = last;
+      sync_wait(scope.on_empty());
+    }};
+    spawner.join();
+    REQUIRE(spawned != nullptr);
+    CHECK(respawned == spawned);
+  }
 } // namespace
@@ -5,6 +5,7 @@
 #include <exec/just_from.hpp>
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
+#include "test_common/allocators.hpp"
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -471,4 +472,31 @@ namespace {
     // ex::start(op);
     expect_empty(scope);
   }
+
+  TEST_CASE(
+    "spawn_future allocates its state with the allocator of the env",
+    "[async_scope][spawn_future]") {
+    impulse_scheduler sch;
+    async_scope scope;
+    allocation_counts counts;
+    auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}};
+
+    {
+      ex::sender auto snd = scope.spawn_future(ex::starts_on(sch, ex::just(13)), env);
+      CHECK(counts.allocations == 1);
+      CHECK(counts.alive == 1);
+      sch.start_next();
+      auto [val] = sync_wait(std::move(snd)).value();
+      CHECK(val == 13);
+    }
+    CHECK(counts.alive == 0);
+
+    // Dropping the future before the work completes hands the state over to the work.
+    (void) scope.spawn_future(ex::starts_on(sch, ex::just()), env);
+    CHECK(counts.allocations == 2);
+    CHECK(counts.alive == 1);
+    sch.start_next();
+    CHECK(counts.alive == 0);
+    expect_empty(scope);
+  }
 } // namespace
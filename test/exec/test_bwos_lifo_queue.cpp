@@ -18,6 +18,14 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
 TEST_CASE("exec::bwos::lifo_queue - ", "[bwos]") {
   exec::bwos::lifo_queue<int*> queue(8, 2);
   int x = 1;
@@ -77,4 +85,122 @@ TEST_CASE("exec::bwos::lifo_queue - ", "[bwos]") {
     CHECK(queue.pop_back() == &y);
     CHECK(queue.pop_back() == nullptr);
   }
-}
\ No newline at end of file
+}
+namespace {
+  struct contention_result {
+    std::size_t owner_ops{0};
+    std::size_t steals{0};
+    double seconds{0.0};
+    // Whether every value was taken exactly once.
+    bool consistent{false};
+  };
+
+  // The owner pushes `num_items` values and pops every other one back while `num_thieves`
+  // threads keep stealing from the front.
+  auto owner_against_thieves(
+    exec::bwos::lifo_queue_layout layout,
+    std::size_t num_thieves,
+    std::size_t num_items) -> contention_result {
+    exec::bwos::lifo_queue<int*> queue(8, 8, std::allocator<int*>(), layout);
+    std::vector<int> items(num_items);
+    std::vector<std::atomic<int>> taken(num_items);
+    auto take = [&](int* item) {
+      taken[static_cast<std::size_t>(item - items.data())].fetch_add(1, std::memory_order_relaxed);
+    };
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> steals{0};
+    std::vector<std::thread> thieves;
+    for (std::size_t t = 0; t < num_thieves; ++t) {
+      thieves.emplace_back([&] {
+        std::size_t n = 0;
+        while (true) {
+          const bool was_done = done.load(std::memory_order_acquire);
+          if (int* item = queue.steal_front()) {
+            take(item);
+            ++n;
+          } else if (was_done) {
+            break;
+          }
+        }
+        steals.fetch_add(n, std::memory_order_relaxed);
+      });
+    }
+
+    contention_result result{};
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < num_items; ++i) {
+      while (!queue.push_back(&items[i])) {
+        if (int* item = queue.pop_back()) {
+          take(item);
+          ++result.owner_ops;
+        }
+      }
+      ++result.owner_ops;
+      if (i % 2 == 1) {
+        if (int* item = queue.pop_back()) {
+          take(item);
+          ++result.owner_ops;
+        }
+      }
+    }
+    while (int* item = queue.pop_back()) {
+      take(item);
+      ++result.owner_ops;
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief: thieves) {
+      thief.join();
+    }
+    result.seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.steals = steals.load();
+    result.consistent = true;
+    for (const auto& count: taken) {
+      result.consistent &= count.load() == 1;
+    }
+    return result;
+  }
+} // namespace
+
+TEST_CASE("exec::bwos::lifo_queue - layouts", "[bwos]") {
+  int x = 1;
+  SECTION("Huge pages") {
+    exec::bwos::lifo_queue<int*> queue(4, 2, std::allocator<int*>(), {.hugePages = true});
+    CHECK(queue.push_back(&x));
+    CHECK(queue.pop_back() == &x);
+  }
+  SECTION("Move") {
+    exec::bwos::lifo_queue<int*> queue(4, 2);
+    CHECK(queue.push_back(&x));
+    exec::bwos::lifo_queue<int*> moved(std::move(queue));
+    CHECK(moved.num_blocks() == 4);
+    CHECK(moved.pop_back() == &x);
+    CHECK(moved.push_back(&x));
+    CHECK(moved.steal_front() == nullptr);
+    CHECK(moved.pop_back() == &x);
+  }
+  SECTION("Owner against thieves") {
+    for (bool pad: {false, true}) {
+      const auto result = owner_against_thieves({.padBlocks = pad}, 3, 20'000);
+      CHECK(result.consistent);
+    }
+  }
+}
+
+// Run with `test.exec "[bwos][benchmark]"`.
+TEST_CASE("exec::bwos::lifo_queue - owner push/pop against thieves", "[.][bwos][benchmark]") {
+  constexpr std::size_t num_items = 2'000'000;
+  for (std::size_t num_thieves: {1, 3, 7, 15, 31, 63}) {
+    for (bool pad: {false, true}) {
+      const auto result = owner_against_thieves({.padBlocks = pad}, num_thieves, num_items);
+      CHECK(result.consistent);
+      std::printf(
+        "thieves: %2zu, padded blocks: %d, owner: %6.2f Mops/s, steals: %6.2f Mops/s\n",
+        num_thieves,
+        pad ? 1 : 0,
+        double(result.owner_ops) / result.seconds * 1e-6,
+        double(result.steals) / result.seconds * 1e-6);
+    }
+  }
+}
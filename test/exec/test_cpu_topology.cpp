@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "exec/__detail/__cpu_topology.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+  void write_file(const fs::path& path, const std::string& content) {
+    fs::create_directories(path.parent_path());
+    std::ofstream{path} << content << '\n';
+  }
+
+  // Two packages with two SMT-2 cores each. Package 0 reports the id of its L3 cache, package 1
+  // only the list of CPUs that share it.
+  struct fake_sysfs {
+    fake_sysfs()
+      : root_(
+          fs::temp_directory_path()
+          / ("stdexec_cpu_topology_"
+             + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))) {
+      write_file(root_ / "online", "0-5,6-7");
+      write_file(root_ / "isolated", "7");
+      for (int cpu = 0; cpu < 8; ++cpu) {
+        const fs::path dir = root_ / ("cpu" + std::to_string(cpu));
+        const int package = (cpu / 2) % 2;
+        write_file(dir / "topology" / "core_id", std::to_string(cpu % 2));
+        write_file(dir / "topology" / "physical_package_id", std::to_string(package));
+        write_file(dir / "cache" / "index0" / "level", "1");
+        write_file(dir / "cache" / "index1" / "level", "3");
+        if (package == 0) {
+          write_file(dir / "cache" / "index1" / "id", "0");
+        } else {
+          write_file(dir / "cache" / "index1" / "shared_cpu_list", "2-3,6-7");
+        }
+        fs::create_directories(dir / ("node" + std::to_string(package)));
+      }
+    }
+
+    ~fake_sysfs() {
+      std::error_code ec;
+      fs::remove_all(root_, ec);
+    }
+
+    fs::path root_;
+  };
+
+  auto cpu_numbers(const std::vector<exec::cpu_info>& cpus) -> std::vector<int> {
+    std::vector<int> result;
+    for (const auto& info: cpus) {
+      result.push_back(info.cpu);
+    }
+    return result;
+  }
+} // namespace
+
+TEST_CASE("exec::cpu_topology - reads sysfs", "[cpu_topology]") {
+  fake_sysfs sysfs;
+  const auto topology = exec::cpu_topology::from_sysfs(sysfs.root_);
+  REQUIRE(topology.cpus().size() == 8);
+
+  const exec::cpu_info& cpu5 = topology.cpus()[5];
+  CHECK(cpu5.cpu == 5);
+  CHECK(cpu5.core == 1);
+  CHECK(cpu5.package == 0);
+  CHECK(cpu5.l3 == 0);
+  CHECK(cpu5.node == 0);
+  CHECK_FALSE(cpu5.isolated);
+
+  const exec::cpu_info& cpu7 = topology.cpus()[7];
+  CHECK(cpu7.package == 1);
+  CHECK(cpu7.l3 == 2);
+  CHECK(cpu7.node == 1);
+  CHECK(cpu7.isolated);
+
+  CHECK(exec::cpu_topology::from_sysfs(sysfs.root_ / "missing").cpus().empty());
+}
+
+TEST_CASE("exec::cpu_topology - places workers", "[cpu_topology]") {
+  fake_sysfs sysfs;
+  const auto topology = exec::cpu_topology::from_sysfs(sysfs.root_);
+  using exec::cpu_placement;
+
+  CHECK(topology.place({.placement = cpu_placement::none}).empty());
+  CHECK(
+    cpu_numbers(topology.place({.placement = cpu_placement::compact, .excludeIsolated = false}))
+    == std::vector{0, 4, 1, 5, 2, 6, 3, 7});
+  CHECK(
+    cpu_numbers(topology.place({.placement = cpu_placement::compact})) //
+    == std::vector{0, 4, 1, 5, 2, 6, 3});
+  CHECK(
+    cpu_numbers(topology.place({.placement = cpu_placement::compact, .onePerCore = true}))
+    == std::vector{0, 1, 2, 3});
+  CHECK(
+    cpu_numbers(topology.place({.placement = cpu_placement::scatter, .excludeIsolated = false}))
+    == std::vector{0, 2, 1, 3, 4, 6, 5, 7});
+  CHECK(
+    cpu_numbers(topology.place({.placement = cpu_placement::scatter, .onePerCore = true}))
+    == std::vector{0, 2, 1, 3});
+}
@@ -26,8 +26,23 @@
 #  include "exec/single_thread_context.hpp"
 #  include "exec/finally.hpp"
 #  include "exec/when_any.hpp"
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
 
 #  include "catch2/catch.hpp"
+#  include "test_common/allocators.hpp"
+
+#  include <array>
+#  include <cstring>
+#  include <optional>
+#  include <span>
+#  include <stdexcept>
+#  include <string>
+#  include <vector>
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
 
 using namespace stdexec;
 using namespace exec;
@@ -331,6 +346,598 @@ namespace {
     CHECK(sync_wait(exec::when_any(schedule(scheduler), context.run())));
     CHECK(!sync_wait(exec::when_any(schedule(scheduler), context.run())));
   }
+
+  TEST_CASE("io_uring_context - hand over work between rings", "[types][io_uring][schedulers]") {
+    io_uring_context context1;
+    io_uring_context context2;
+    io_uring_scheduler scheduler1 = context1.get_scheduler();
+    io_uring_scheduler scheduler2 = context2.get_scheduler();
+    jthread io_thread1{[&] { context1.run_until_stopped(); }};
+    jthread io_thread2{[&] { context2.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept {
+      context1.request_stop();
+      context2.request_stop();
+    }};
+    int n_handovers = 0;
+    for (int i = 0; i < 100; ++i) {
+      sync_wait(schedule(scheduler1) | let_value([&] {
+                  return when_all(schedule(scheduler2), schedule_after(scheduler2, 0ms))
+                       | then([&] {
+                           CHECK(io_thread2.get_id() == std::this_thread::get_id());
+                           ++n_handovers;
+                         });
+                }));
+    }
+    CHECK(n_handovers == 100);
+  }
+
+  TEST_CASE(
+    "io_uring_context - destroy a context right after another ring woke it up",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context1;
+    io_uring_scheduler scheduler1 = context1.get_scheduler();
+    jthread io_thread1{[&] { context1.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context1.request_stop(); }};
+    for (int i = 0; i < 100; ++i) {
+      std::optional<io_uring_context> context2{std::in_place};
+      io_uring_scheduler scheduler2 = context2->get_scheduler();
+      {
+        jthread io_thread2{[&] { context2->run_until_stopped(); }};
+        // The wakeup of the second ring is posted from the ring of the first one.
+        sync_wait(schedule(scheduler1) | let_value([&] { return schedule(scheduler2); }));
+        context2->request_stop();
+      }
+      context2.reset();
+    }
+  }
+
+  TEST_CASE("io_uring_context - read and write a pipe", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    const char message[] = "hello";
+    auto [n_written] =
+      sync_wait(scheduler.async_write_some(write_end, std::as_bytes(std::span{message, 5}))).value();
+    CHECK(n_written == 5);
+
+    std::array<std::byte, 16> buffer{};
+    auto read = scheduler.async_read_some(read_end, buffer) | then([&](std::size_t n) {
+                  CHECK(io_thread.get_id() == std::this_thread::get_id());
+                  return n;
+                });
+    auto [n_read] = sync_wait(std::move(read)).value();
+    CHECK(n_read == 5);
+    CHECK(std::memcmp(buffer.data(), message, 5) == 0);
+  }
+
+  TEST_CASE("io_uring_context - vectored io at an offset", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    char path[] = "/tmp/stdexec_io_uring_XXXXXX";
+    safe_file_descriptor file{::mkstemp(path)};
+    REQUIRE(file);
+    ::unlink(path);
+
+    char first[] = "abc";
+    char second[] = "def";
+    std::array<::iovec, 2> out{
+      ::iovec{first, 3},
+      ::iovec{second, 3}
+    };
+    auto [n_written] = sync_wait(scheduler.async_write_some(file, std::span{out}, 4)).value();
+    CHECK(n_written == 6);
+
+    std::array<char, 6> in{};
+    auto [n_read] =
+      sync_wait(scheduler.async_read_some(file, std::as_writable_bytes(std::span{in}), 4)).value();
+    CHECK(n_read == 6);
+    CHECK(std::memcmp(in.data(), "abcdef", 6) == 0);
+  }
+
+  TEST_CASE("io_uring_context - report io errors", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    std::array<std::byte, 16> buffer{};
+    bool is_read = false;
+    std::error_code error{};
+    sync_wait(
+      scheduler.async_read_some(-1, buffer) | then([&](std::size_t) noexcept { is_read = true; })
+      | upon_error([&](std::error_code ec) noexcept { error = ec; }));
+    CHECK_FALSE(is_read);
+    CHECK(error == std::errc::bad_file_descriptor);
+  }
+
+  TEST_CASE("io_uring_context - cancel a pending read", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    std::array<std::byte, 16> buffer{};
+    bool is_read = false;
+    bool is_timeout = false;
+    sync_wait(when_any(
+      scheduler.async_read_some(read_end, buffer) | then([&](std::size_t) { is_read = true; }),
+      schedule_after(scheduler, 1ms) | then([&] { is_timeout = true; })));
+    CHECK_FALSE(is_read);
+    CHECK(is_timeout);
+  }
+
+  TEST_CASE("io_uring_context - linked write, read and fsync", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    char path[] = "/tmp/stdexec_io_uring_XXXXXX";
+    safe_file_descriptor file{::mkstemp(path)};
+    REQUIRE(file);
+    ::unlink(path);
+
+    const char out[] = "hello";
+    std::array<char, 5> in{};
+    auto [n_written, n_read] = sync_wait(exec::io_uring_link(
+                                           scheduler.async_write_some(
+                                             file, std::as_bytes(std::span{out, 5}), 0),
+                                           scheduler.async_read_some(
+                                             file, std::as_writable_bytes(std::span{in}), 0),
+                                           scheduler.async_fsync(file)))
+                                 .value();
+    CHECK(n_written == 5);
+    CHECK(n_read == 5);
+    CHECK(std::memcmp(in.data(), "hello", 5) == 0);
+  }
+
+  TEST_CASE("io_uring_context - chains are submitted as a whole", "[types][io_uring][io]") {
+    io_uring_context context{4};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    std::array<safe_file_descriptor, 6> pipes;
+    for (std::size_t i = 0; i < pipes.size(); i += 2) {
+      int fds[2];
+      REQUIRE(::pipe(fds) == 0);
+      pipes[i].reset(fds[0]);
+      pipes[i + 1].reset(fds[1]);
+    }
+    const std::byte out[2]{std::byte{1}, std::byte{2}};
+    std::array<std::array<std::byte, 2>, 3> in{};
+    auto chain = [&](std::size_t i) {
+      return exec::io_uring_link(
+        scheduler.async_write_some(pipes[2 * i + 1], std::span{out}),
+        scheduler.async_read_some(pipes[2 * i], std::span{in[i]}),
+        scheduler.async_write_some(pipes[2 * i + 1], std::span{out}));
+    };
+    auto result = sync_wait(when_all(chain(0), chain(1), chain(2)));
+    REQUIRE(result.has_value());
+    for (auto& buffer: in) {
+      CHECK(buffer[0] == std::byte{1});
+      CHECK(buffer[1] == std::byte{2});
+    }
+  }
+
+  TEST_CASE("io_uring_context - chains must fit into the ring", "[types][io_uring][io]") {
+    io_uring_context context{2};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    std::array<std::byte, 4> buffer{};
+    CHECK_THROWS_AS(
+      exec::io_uring_link(
+        scheduler.async_write_some(write_end, buffer),
+        scheduler.async_write_some(write_end, buffer),
+        scheduler.async_read_some(read_end, buffer)),
+      std::invalid_argument);
+  }
+
+  TEST_CASE("io_uring_context - a failing step breaks a chain", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    std::array<std::byte, 4> buffer{};
+    bool is_done = false;
+    std::error_code error{};
+    sync_wait(
+      exec::io_uring_link(
+        scheduler.async_read_some(-1, buffer), scheduler.async_write_some(write_end, buffer))
+      | then([&](std::size_t, std::size_t) noexcept { is_done = true; })
+      | upon_error([&](std::error_code ec) noexcept { error = ec; }));
+    CHECK_FALSE(is_done);
+    CHECK(error == std::errc::bad_file_descriptor);
+    // The write has been cancelled.
+    CHECK(::write(write_end, "x", 1) == 1);
+    CHECK(::read(read_end, buffer.data(), buffer.size()) == 1);
+  }
+
+  TEST_CASE("io_uring_context - cancel a linked chain", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    std::array<std::byte, 16> buffer{};
+    bool is_done = false;
+    bool is_timeout = false;
+    sync_wait(when_any(
+      exec::io_uring_link(
+        scheduler.async_read_some(read_end, buffer), scheduler.async_write_some(write_end, buffer))
+        | then([&](std::size_t, std::size_t) { is_done = true; }),
+      schedule_after(scheduler, 1ms) | then([&] { is_timeout = true; })));
+    CHECK_FALSE(is_done);
+    CHECK(is_timeout);
+  }
+
+  TEST_CASE("io_uring_context - submission queue polling", "[types][io_uring][io]") {
+    io_uring_context context{64, io_uring_options{.sq_poll = true, .sq_thread_idle = 1}};
+    CHECK(context.is_sq_polled());
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    safe_file_descriptor read_end{fds[0]};
+    safe_file_descriptor write_end{fds[1]};
+
+    for (int i = 0; i < 3; ++i) {
+      // Give the kernel thread time to go idle so that it needs an explicit wakeup.
+      std::this_thread::sleep_for(5ms);
+      std::array<std::byte, 4> buffer{};
+      auto [n_written, n_read] =
+        sync_wait(when_all(
+                    scheduler.async_write_some(write_end, std::as_bytes(std::span{"ping", 4})),
+                    scheduler.async_read_some(read_end, buffer)))
+          .value();
+      CHECK(n_written == 4);
+      CHECK(n_read == 4);
+    }
+    bool is_called = false;
+    sync_wait(schedule_after(scheduler, 1ms) | then([&] { is_called = true; }));
+    CHECK(is_called);
+  }
+
+  TEST_CASE("io_uring_context - completion polling", "[types][io_uring][io]") {
+    io_uring_context context{64, io_uring_options{.io_poll = true}};
+    CHECK(context.is_io_polled());
+    io_uring_scheduler scheduler = context.get_scheduler();
+    bool is_called = false;
+    start_detached(schedule(scheduler) | then([&] { is_called = true; }));
+    context.run_until_empty();
+    CHECK(is_called);
+    CHECK(!context.is_running());
+
+    is_called = false;
+    sync_wait(when_any(schedule(scheduler) | then([&] { is_called = true; }), context.run()));
+    CHECK(is_called);
+    CHECK(context.stop_requested());
+  }
+
+  TEST_CASE("io_uring_context - registered buffers and files", "[types][io_uring][io]") {
+    io_uring_context context;
+    context.register_buffers(2, 4096);
+    REQUIRE(context.registered_buffer_count() == 2);
+    char path[] = "/tmp/stdexec_io_uring_XXXXXX";
+    safe_file_descriptor file{::mkstemp(path)};
+    REQUIRE(file);
+    ::unlink(path);
+    int fds[] = {-1, file};
+    context.register_files(fds);
+
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+
+    registered_buffer out = context.registered_buffer_at(0).subspan(0, 5);
+    std::memcpy(out.data.data(), "fixed", 5);
+    auto [n_written] = sync_wait(scheduler.async_write_some(registered_file{1}, out, 0)).value();
+    CHECK(n_written == 5);
+
+    registered_buffer in = context.registered_buffer_at(1);
+    auto [n_read] = sync_wait(scheduler.async_read_some(file, in, 0)).value();
+    CHECK(n_read == 5);
+    CHECK(std::memcmp(in.data.data(), "fixed", 5) == 0);
+
+    std::array<std::byte, 5> plain{};
+    auto [n_plain] = sync_wait(scheduler.async_read_some(registered_file{1}, plain, 0)).value();
+    CHECK(n_plain == 5);
+    CHECK(std::memcmp(plain.data(), "fixed", 5) == 0);
+
+    std::error_code error{};
+    sync_wait(
+      scheduler.async_read_some(registered_file{0}, in, 0) | then([](std::size_t) noexcept { })
+      | upon_error([&](std::error_code ec) noexcept { error = ec; }));
+    CHECK(error == std::errc::bad_file_descriptor);
+  }
+
+#  ifdef STDEXEC_HAS_IORING_SOCKET_OPS
+  TEST_CASE("io_uring_context - accept and connect on loopback", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    REQUIRE(listener);
+    ::sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+    REQUIRE(::listen(listener, 1) == 0);
+    ::socklen_t addrlen = sizeof(addr);
+    REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &addrlen) == 0);
+
+    safe_file_descriptor client{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    REQUIRE(client);
+    auto [server] = sync_wait(when_all(
+                                scheduler.async_accept(listener),
+                                scheduler.async_connect(
+                                  client, reinterpret_cast<const ::sockaddr*>(&addr), addrlen)))
+                      .value();
+    REQUIRE(server);
+
+    const char message[] = "ping";
+    std::array<std::byte, 16> buffer{};
+    auto [n_sent, n_received] =
+      sync_wait(when_all(
+                  scheduler.async_send(client, std::as_bytes(std::span{message, 4})),
+                  scheduler.async_recv(server, buffer)))
+        .value();
+    CHECK(n_sent == 4);
+    CHECK(n_received == 4);
+    CHECK(std::memcmp(buffer.data(), message, 4) == 0);
+
+    client.reset();
+    auto [n_eof] = sync_wait(scheduler.async_recv(server, buffer)).value();
+    CHECK(n_eof == 0);
+  }
+
+  TEST_CASE("io_uring_context - connect to a closed port", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    ::sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+    ::socklen_t addrlen = sizeof(addr);
+    REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &addrlen) == 0);
+
+    safe_file_descriptor client{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    std::error_code error{};
+    sync_wait(
+      scheduler.async_connect(client, reinterpret_cast<const ::sockaddr*>(&addr), addrlen)
+      | upon_error([&](std::error_code ec) noexcept { error = ec; }));
+    CHECK(error == std::errc::connection_refused);
+  }
+
+  TEST_CASE("io_uring_context - sendmsg and recvmsg", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, fds) == 0);
+    safe_file_descriptor first{fds[0]};
+    safe_file_descriptor second{fds[1]};
+
+    char header[] = "ab";
+    char body[] = "cd";
+    std::array<::iovec, 2> out{
+      ::iovec{header, 2},
+      ::iovec{ body, 2}
+    };
+    ::msghdr out_msg{};
+    out_msg.msg_iov = out.data();
+    out_msg.msg_iovlen = out.size();
+
+    std::array<char, 8> in{};
+    ::iovec in_iov{in.data(), in.size()};
+    ::msghdr in_msg{};
+    in_msg.msg_iov = &in_iov;
+    in_msg.msg_iovlen = 1;
+
+    auto [n_sent, n_received] = sync_wait(when_all(
+                                            scheduler.async_sendmsg(first, out_msg),
+                                            scheduler.async_recvmsg(second, in_msg)))
+                                  .value();
+    CHECK(n_sent == 4);
+    CHECK(n_received == 4);
+    CHECK(std::memcmp(in.data(), "abcd", 4) == 0);
+  }
+#  endif
+
+#  ifdef STDEXEC_HAS_IORING_MULTISHOT
+  auto make_loopback_listener(::sockaddr_in& addr) -> safe_file_descriptor {
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    addr = ::sockaddr_in{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+    ::socklen_t addrlen = sizeof(addr);
+    if (
+      ::bind(listener, reinterpret_cast<::sockaddr*>(&addr), addrlen) != 0
+      || ::listen(listener, 8) != 0
+      || ::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &addrlen) != 0) {
+      return safe_file_descriptor{};
+    }
+    return listener;
+  }
+
+  TEST_CASE("io_uring_context - multishot accept", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    ::sockaddr_in addr{};
+    safe_file_descriptor listener = make_loopback_listener(addr);
+    REQUIRE(listener);
+
+    std::vector<safe_file_descriptor> accepted;
+    stdexec::inplace_stop_source stop_source;
+    auto accept_all = scheduler.async_accept_multishot(listener)
+                    | exec::transform_each(then([&](safe_file_descriptor fd) {
+                        CHECK(io_thread.get_id() == std::this_thread::get_id());
+                        accepted.push_back(std::move(fd));
+                        if (accepted.size() == 3) {
+                          stop_source.request_stop();
+                        }
+                      }))
+                    | exec::ignore_all_values();
+
+    std::array<safe_file_descriptor, 3> clients;
+    for (auto& client: clients) {
+      client.reset(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0));
+      REQUIRE(::connect(client, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+    }
+    auto result = sync_wait(
+      write_env(std::move(accept_all), prop{get_stop_token, stop_source.get_token()}));
+    CHECK_FALSE(result.has_value());
+    REQUIRE(accepted.size() == 3);
+    for (auto& fd: accepted) {
+      CHECK(fd);
+    }
+  }
+
+  TEST_CASE(
+    "io_uring_context - multishot items reuse the storage of finished items",
+    "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    ::sockaddr_in addr{};
+    safe_file_descriptor listener = make_loopback_listener(addr);
+    REQUIRE(listener);
+
+    std::size_t num_accepted = 0;
+    allocation_counts counts;
+    stdexec::inplace_stop_source stop_source;
+    auto accept_all = scheduler.async_accept_multishot(listener)
+                    | exec::transform_each(then([&](safe_file_descriptor fd) {
+                        CHECK(fd);
+                        if (++num_accepted == 3) {
+                          stop_source.request_stop();
+                        }
+                      }))
+                    | exec::ignore_all_values();
+
+    std::array<safe_file_descriptor, 3> clients;
+    for (auto& client: clients) {
+      client.reset(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0));
+      REQUIRE(::connect(client, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+    }
+    sync_wait(write_env(
+      write_env(std::move(accept_all), prop{get_allocator, counting_allocator<std::byte>{counts}}),
+      prop{get_stop_token, stop_source.get_token()}));
+    REQUIRE(num_accepted == 3);
+    // Every item finishes before the next one is produced, so all of them share one block.
+    CHECK(counts.allocations == 1);
+    CHECK(counts.alive == 0);
+  }
+
+#    ifdef STDEXEC_HAS_IORING_RECV_MULTISHOT
+  // Some kernels accept the registration of a buffer ring but never select a buffer from it.
+  template <class Fn>
+  auto buffer_rings_are_supported(Fn fn) -> bool {
+    bool has_value = false;
+    try {
+      has_value = fn().has_value();
+    } catch (const std::system_error& error) {
+      if (error.code() != std::errc::no_buffer_space) {
+        throw;
+      }
+      WARN("io_uring_context: provided buffer rings are not supported by this kernel");
+      return false;
+    }
+    CHECK(has_value);
+    return true;
+  }
+
+  TEST_CASE("io_uring_context - multishot recv with a buffer ring", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_buffer_ring ring{context, 7, 4, 64};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) == 0);
+    safe_file_descriptor reader{fds[0]};
+    safe_file_descriptor writer{fds[1]};
+
+    const char* messages[] = {"a", "bb", "ccc", "dddd", "eeeee", "ffffff"};
+    for (const char* message: messages) {
+      REQUIRE(::write(writer, message, std::strlen(message)) > 0);
+    }
+    writer.reset();
+
+    std::vector<std::string> received;
+    auto recv_all = scheduler.async_recv_multishot(reader, ring)
+                  | exec::transform_each(then([&](io_uring_provided_buffer buffer) {
+                      auto data = buffer.data();
+                      received.emplace_back(
+                        reinterpret_cast<const char*>(data.data()), data.size());
+                    }))
+                  | exec::ignore_all_values();
+    if (!buffer_rings_are_supported([&] { return sync_wait(std::move(recv_all)); })) {
+      return;
+    }
+    REQUIRE(received.size() == std::size(messages));
+    for (std::size_t i = 0; i < received.size(); ++i) {
+      CHECK(received[i] == messages[i]);
+    }
+  }
+
+  TEST_CASE("io_uring_context - stop a multishot recv", "[types][io_uring][io]") {
+    io_uring_context context;
+    io_uring_buffer_ring ring{context, 0, 2, 64};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] { context.run_until_stopped(); }};
+    scope_guard guard{[&]() noexcept { context.request_stop(); }};
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) == 0);
+    safe_file_descriptor reader{fds[0]};
+    safe_file_descriptor writer{fds[1]};
+
+    bool is_timeout = false;
+    if (!buffer_rings_are_supported([&] {
+          return sync_wait(when_any(
+            scheduler.async_recv_multishot(reader, ring) | exec::ignore_all_values(),
+            schedule_after(scheduler, 1ms) | then([&] { is_timeout = true; })));
+        })) {
+      return;
+    }
+    CHECK(is_timeout);
+  }
+#    endif
+#  endif
 } // namespace
 
 #endif
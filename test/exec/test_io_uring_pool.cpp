@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+// Some kernel versions have <linux/io_uring.h> but don't support or don't
+// allow user access to some of the necessary system calls.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_pool.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <array>
+#  include <atomic>
+#  include <set>
+#  include <span>
+#  include <thread>
+#  include <sched.h>
+#  include <unistd.h>
+
+using namespace stdexec;
+using namespace exec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  TEST_CASE("io_uring_pool - satisfies concepts", "[types][io_uring][schedulers]") {
+    STATIC_REQUIRE(scheduler<io_uring_pool_scheduler>);
+    STATIC_REQUIRE(__timed_scheduler<io_uring_pool_scheduler>);
+  }
+
+  TEST_CASE("io_uring_pool - distributes work over its rings", "[types][io_uring][schedulers]") {
+    io_uring_pool pool{3};
+    io_uring_pool_scheduler scheduler = pool.get_scheduler();
+    REQUIRE(pool.size() == 3);
+    std::set<std::thread::id> ids;
+    for (int i = 0; i < 6; ++i) {
+      auto [id] =
+        sync_wait(schedule(scheduler) | then([] { return std::this_thread::get_id(); })).value();
+      ids.insert(id);
+    }
+    CHECK(ids.size() == 3);
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+      CHECK(ids.contains(pool.get_thread_id(i)));
+    }
+  }
+
+  TEST_CASE("io_uring_pool - stays on the local ring", "[types][io_uring][schedulers]") {
+    io_uring_pool pool{4};
+    io_uring_pool_scheduler scheduler = pool.get_scheduler();
+    auto on_same_thread = schedule(scheduler) | let_value([&] {
+                            auto id = std::this_thread::get_id();
+                            return schedule_after(scheduler, 1ms)
+                                 | then([id] { return id == std::this_thread::get_id(); });
+                          });
+    auto [is_same_thread] = sync_wait(std::move(on_same_thread)).value();
+    CHECK(is_same_thread);
+  }
+
+  TEST_CASE(
+    "io_uring_pool - picks the ring of the thread that connects a sender",
+    "[types][io_uring][schedulers]") {
+    io_uring_pool pool{4};
+    io_uring_pool_scheduler scheduler = pool.get_scheduler();
+    // Created outside of the pool, connected and started on the thread of ring 2.
+    auto get_id = schedule(scheduler) | then([] { return std::this_thread::get_id(); });
+    auto [id] =
+      sync_wait(schedule(pool.ring(2).get_scheduler()) | let_value([&] { return get_id; }))
+        .value();
+    CHECK(id == pool.get_thread_id(2));
+  }
+
+  TEST_CASE("io_uring_pool - pins its threads to CPUs", "[types][io_uring][schedulers]") {
+    const exec::affinity_params affinity{.placement = exec::cpu_placement::compact};
+    const auto cpus = exec::cpu_topology::current().place(affinity);
+    io_uring_pool pool{2, 64, {}, affinity};
+    CHECK(pool.affinity().placement == exec::cpu_placement::compact);
+    for (std::size_t i = 0; i < pool.size() && !cpus.empty(); ++i) {
+      auto on_ring = schedule(pool.ring(i).get_scheduler());
+      auto [cpu] = sync_wait(on_ring | then([] { return ::sched_getcpu(); })).value();
+      CHECK(cpu == cpus[i % cpus.size()].cpu);
+    }
+  }
+
+  TEST_CASE("io_uring_pool - io on a ring of the pool", "[types][io_uring][io]") {
+    io_uring_pool pool{2};
+    io_uring_pool_scheduler scheduler = pool.get_scheduler();
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    const char out[] = "pool";
+    std::array<char, 4> in{};
+    auto ring = scheduler.ring_scheduler();
+    auto [n_written] =
+      sync_wait(ring.async_write_some(fds[1], std::as_bytes(std::span{out, 4}))).value();
+    auto [n_read] =
+      sync_wait(ring.async_read_some(fds[0], std::as_writable_bytes(std::span{in}))).value();
+    CHECK(n_written == 4);
+    CHECK(n_read == 4);
+    ::close(fds[0]);
+    ::close(fds[1]);
+  }
+
+  TEST_CASE("io_uring_pool - request_stop stops all rings", "[types][io_uring][schedulers]") {
+    io_uring_pool pool{2};
+    std::atomic<int> n_stopped{0};
+    auto wait_on = [&](std::size_t i) {
+      return schedule_after(pool.ring(i).get_scheduler(), 10s) | then([] { CHECK(false); })
+           | upon_stopped([&] { ++n_stopped; });
+    };
+    sync_wait(when_all(
+      wait_on(0),
+      wait_on(1),
+      schedule_after(pool.get_scheduler(), 1ms) | then([&] { pool.request_stop(); })));
+    CHECK(n_stopped == 2);
+  }
+} // namespace
+
+#endif
@@ -1,10 +1,29 @@
 #include "catch2/catch.hpp"
+#include <exec/async_scope.hpp>
+#include <exec/sequence/ignore_all_values.hpp>
+#include <exec/sequence/transform_each.hpp>
 #include <exec/static_thread_pool.hpp>
+#include <exec/when_any.hpp>
 #include <stdexec/execution.hpp>
+#include "test_common/allocators.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <ranges>
+#include <stdexcept>
 #include <thread>
 #include <unordered_set>
+#include <vector>
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
 namespace ex = stdexec;
 
 TEST_CASE(
@@ -57,3 +76,559 @@ TEST_CASE(
   ex::sync_wait(std::move(sender));
   REQUIRE(thread_ids.size() == num_of_threads);
 }
+
+TEST_CASE(
+  "static_thread_pool runs bursts of work with any spin policy",
+  "[types][static_thread_pool]") {
+  constexpr std::uint32_t num_of_threads = 4;
+  for (exec::spin_params spin:
+       {exec::spin_params{.minSpins = 0, .maxSpins = 0},
+        exec::spin_params{},
+        exec::spin_params{.minSpins = 1024, .maxSpins = 1024, .pausesPerSpin = 1}}) {
+    exec::static_thread_pool pool{num_of_threads, {.spin = spin}};
+    CHECK(pool.spin().maxSpins == spin.maxSpins);
+    for (int burst = 0; burst < 20; ++burst) {
+      std::atomic<int> count{0};
+      auto sender = ex::when_all(
+        ex::schedule(pool.get_scheduler()) | ex::then([&] { ++count; }),
+        ex::schedule(pool.get_scheduler()) | ex::then([&] { ++count; }),
+        ex::schedule(pool.get_scheduler()) | ex::then([&] { ++count; }));
+      ex::sync_wait(std::move(sender));
+      CHECK(count == 3);
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+}
+
+TEST_CASE(
+  "bulk on static_thread_pool with dynamic chunking visits every index once",
+  "[types][static_thread_pool]") {
+  constexpr std::uint32_t num_of_threads = 4;
+  for (std::size_t grain: {0, 1, 3, 64, 1000}) {
+    exec::static_thread_pool pool{
+      num_of_threads, {.bulk = {.chunking = exec::bulk_chunking::dynamic, .grainSize = grain}}};
+    for (int shape: {1, 7, 100, 1031}) {
+      std::vector<std::atomic<int>> visits(static_cast<std::size_t>(shape));
+      auto sender = ex::schedule(pool.get_scheduler())
+                  | ex::bulk(ex::par, shape, [&](int i) { ++visits[static_cast<std::size_t>(i)]; });
+      ex::sync_wait(std::move(sender));
+      for (auto& n: visits) {
+        REQUIRE(n == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE(
+  "bulk on static_thread_pool with dynamic chunking does not wait for a slow chunk",
+  "[types][static_thread_pool]") {
+  constexpr std::uint32_t num_of_threads = 4;
+  exec::static_thread_pool pool{
+    num_of_threads, {.bulk = {.chunking = exec::bulk_chunking::dynamic, .grainSize = 1}}};
+
+  // Index 0 is slow, all other indices are claimed by the other agents in the meantime.
+  std::vector<std::thread::id> thread_ids(64);
+  auto sender = ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par, 64, [&](int i) {
+                  if (i == 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                  }
+                  thread_ids[static_cast<std::size_t>(i)] = std::this_thread::get_id();
+                });
+  ex::sync_wait(std::move(sender));
+  CHECK(std::count(thread_ids.begin(), thread_ids.end(), thread_ids[0]) == 1);
+}
+
+TEST_CASE(
+  "bulk on static_thread_pool with dynamic chunking propagates exceptions",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{
+    4, {.bulk = {.chunking = exec::bulk_chunking::dynamic, .grainSize = 2}}};
+  auto sender = ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par, 100, [](int i) {
+                  if (i == 42) {
+                    throw std::runtime_error("42");
+                  }
+                });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sender)), std::runtime_error);
+}
+
+TEST_CASE(
+  "bulk_unchunked on static_thread_pool executes on multiple threads",
+  "[types][static_thread_pool]") {
+  constexpr const size_t num_of_threads = 5;
+  exec::static_thread_pool pool{num_of_threads};
+
+  std::mutex mtx;
+  std::unordered_set<std::thread::id> thread_ids;
+  auto sender = ex::schedule(pool.get_scheduler())
+              | ex::bulk_unchunked(ex::par, num_of_threads, [&](size_t) -> void {
+                  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                  std::lock_guard lock(mtx);
+                  thread_ids.insert(std::this_thread::get_id());
+                });
+  ex::sync_wait(std::move(sender));
+  REQUIRE(thread_ids.size() == num_of_threads);
+}
+
+TEST_CASE(
+  "bulk_unchunked on static_thread_pool visits every index once",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{4};
+  for (int shape: {0, 1, 3, 1000, 20000}) {
+    std::vector<std::atomic<int>> visits(static_cast<std::size_t>(shape));
+    std::atomic<bool> wrong_value{false};
+    auto sender = ex::just(42) | ex::continues_on(pool.get_scheduler())
+                | ex::bulk_unchunked(ex::par, shape, [&](int i, int value) {
+                    wrong_value = wrong_value || value != 42;
+                    ++visits[static_cast<std::size_t>(i)];
+                  });
+    auto [value] = ex::sync_wait(std::move(sender)).value();
+    CHECK(value == 42);
+    CHECK_FALSE(wrong_value);
+    for (auto& n: visits) {
+      REQUIRE(n == 1);
+    }
+  }
+}
+
+TEST_CASE(
+  "bulk_unchunked on static_thread_pool propagates exceptions",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{4};
+  auto sender = ex::schedule(pool.get_scheduler()) | ex::bulk_unchunked(ex::par, 100, [](int i) {
+                  if (i == 42) {
+                    throw std::runtime_error("42");
+                  }
+                });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sender)), std::runtime_error);
+}
+
+TEST_CASE("static_thread_pool scheduler is a timed_scheduler", "[types][static_thread_pool]") {
+  STATIC_REQUIRE(exec::timed_scheduler<exec::static_thread_pool::scheduler>);
+  exec::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  auto t0 = exec::now(sched);
+
+  SECTION("schedule_after completes on the pool once the duration has passed") {
+    auto sender = exec::schedule_after(sched, std::chrono::milliseconds(10))
+                | ex::then([] { return std::this_thread::get_id(); });
+    auto [id] = ex::sync_wait(std::move(sender)).value();
+    CHECK(exec::now(sched) - t0 >= std::chrono::milliseconds(10));
+    CHECK(id != std::this_thread::get_id());
+  }
+
+  SECTION("schedule_at a point in the past completes immediately") {
+    CHECK(ex::sync_wait(exec::schedule_at(sched, t0 - std::chrono::seconds(1))));
+  }
+
+  SECTION("timers that are started on the pool") {
+    auto sender = ex::schedule(sched) | ex::let_value([sched] {
+                    return ex::when_all(
+                      exec::schedule_after(sched, std::chrono::milliseconds(1)),
+                      exec::schedule_after(sched, std::chrono::milliseconds(20)),
+                      exec::schedule_after(sched, std::chrono::milliseconds(700)));
+                  });
+    CHECK(ex::sync_wait(std::move(sender)));
+    CHECK(exec::now(sched) - t0 >= std::chrono::milliseconds(700));
+  }
+
+  SECTION("stopping a timer completes it with set_stopped") {
+    auto sender = exec::when_any(
+      exec::schedule_after(sched, std::chrono::milliseconds(10)) | ex::then([] { return 1; }),
+      exec::schedule_after(sched, std::chrono::seconds(10)) | ex::then([] { return 2; }));
+    auto [n] = ex::sync_wait(std::move(sender)).value();
+    CHECK(n == 1);
+    CHECK(exec::now(sched) - t0 < std::chrono::seconds(10));
+  }
+}
+
+TEST_CASE("static_thread_pool runs many concurrent timers", "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  std::atomic<int> fired{0};
+  std::atomic<int> early{0};
+  exec::async_scope scope;
+  for (int i = 0; i < 200; ++i) {
+    auto duration = std::chrono::microseconds(250 * (i % 40));
+    scope.spawn(
+      ex::schedule(sched) | ex::let_value([sched, duration, &fired, &early] {
+        auto start = exec::now(sched);
+        return exec::schedule_after(sched, duration) | ex::then([=, &fired, &early] {
+                 early += exec::now(sched) - start < duration;
+                 ++fired;
+               });
+      }));
+    // Half of the timers are cancelled right away.
+    auto stop_source = std::make_shared<ex::inplace_stop_source>();
+    scope.spawn(
+      exec::schedule_after(sched, std::chrono::seconds(30))
+      | ex::then([] { FAIL_CHECK("the timer should have been cancelled"); })
+      | ex::write_env(ex::prop{ex::get_stop_token, stop_source->get_token()})
+      | ex::upon_stopped([stop_source] { }));
+    stop_source->request_stop();
+  }
+  ex::sync_wait(scope.on_empty());
+  CHECK(fired == 200);
+  CHECK(early == 0);
+}
+
+TEST_CASE(
+  "static_thread_pool stops timers while they are being started",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  for (int i = 0; i < 500; ++i) {
+    ex::inplace_stop_source stop_source;
+    std::atomic<bool> go{false};
+    std::thread stopper{[&] {
+      while (!go) {
+        std::this_thread::yield();
+      }
+      stop_source.request_stop();
+    }};
+    go = true;
+    auto result = ex::sync_wait(
+      exec::schedule_after(sched, std::chrono::seconds(30)) | ex::then([] { return false; })
+      | ex::write_env(ex::prop{ex::get_stop_token, stop_source.get_token()})
+      | ex::upon_stopped([] { return true; }));
+    stopper.join();
+    REQUIRE(std::get<0>(result.value()));
+  }
+}
+
+TEST_CASE(
+  "static_thread_pool adapts the number of workers it spreads work over",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{8, {.spread = {.minThreads = 2, .shrinkAfter = 4}}};
+  auto sched = pool.get_scheduler();
+  REQUIRE(pool.spread().minThreads == 2);
+  REQUIRE(pool.active_thread_count() <= 8);
+
+  // A trickle of work keeps waking up workers that find nothing to do.
+  for (int i = 0; i < 20'000 && pool.active_thread_count() > 2; ++i) {
+    ex::sync_wait(ex::schedule(sched));
+  }
+  CHECK(pool.active_thread_count() == 2);
+
+  // Work that piles up while every active worker is busy activates more workers.
+  std::atomic<std::uint32_t> max_active{0};
+  std::atomic<int> counter{0};
+  exec::async_scope scope;
+  ex::sync_wait(ex::schedule(sched) | ex::then([&] {
+                  for (int i = 0; i < 64; ++i) {
+                    scope.spawn(ex::schedule(sched) | ex::then([&] {
+                                  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                  max_active = (std::max) (
+                                    max_active.load(), pool.active_thread_count());
+                                  ++counter;
+                                }));
+                  }
+                }));
+  ex::sync_wait(scope.on_empty());
+  CHECK(counter == 64);
+  CHECK(max_active > 2);
+  CHECK(pool.active_thread_count() <= 8);
+
+  // Workers that are inactive still run work that targets them.
+  for (std::size_t i = 0; i < 8; ++i) {
+    ex::sync_wait(ex::schedule(pool.get_scheduler_on_thread(i)));
+  }
+}
+
+TEST_CASE("static_thread_pool runs high priority work first", "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{1};
+  auto normal = pool.get_scheduler();
+  auto high = pool.get_scheduler(exec::task_priority::high);
+  CHECK(normal.priority() == exec::task_priority::normal);
+  CHECK(high.priority() == exec::task_priority::high);
+  CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(ex::schedule(high))) == high);
+  CHECK(high != normal);
+
+  SECTION("Work submitted from other threads") {
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::vector<int> order;
+    exec::async_scope scope;
+    scope.spawn(ex::schedule(normal) | ex::then([&] {
+                  started = true;
+                  while (!release.load()) {
+                    std::this_thread::yield();
+                  }
+                }));
+    while (!started.load()) {
+      std::this_thread::yield();
+    }
+    for (int i = 0; i < 10; ++i) {
+      scope.spawn(ex::schedule(normal) | ex::then([&order] { order.push_back(0); }));
+    }
+    scope.spawn(ex::schedule(high) | ex::then([&order] { order.push_back(1); }));
+    scope.spawn(exec::schedule_after(high, std::chrono::milliseconds(1)) | ex::then([&order] {
+                  order.push_back(2);
+                }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    release = true;
+    ex::sync_wait(scope.on_empty());
+    REQUIRE(order.size() == 12);
+    // The task and the timer of the high priority lane run before any of the normal tasks.
+    CHECK(order[0] != 0);
+    CHECK(order[1] != 0);
+  }
+
+  SECTION("Normal work is not starved") {
+    std::vector<int> order;
+    exec::async_scope scope;
+    ex::sync_wait(ex::schedule(normal) | ex::then([&] {
+                    scope.spawn(ex::schedule(normal) | ex::then([&order] { order.push_back(0); }));
+                    for (int i = 0; i < 200; ++i) {
+                      scope.spawn(ex::schedule(high) | ex::then([&order] { order.push_back(1); }));
+                    }
+                  }));
+    ex::sync_wait(scope.on_empty());
+    REQUIRE(order.size() == 201);
+    auto normal_position = std::find(order.begin(), order.end(), 0) - order.begin();
+    CHECK(normal_position > 0);
+    CHECK(normal_position <= 64);
+  }
+}
+
+namespace {
+  struct counting_task : exec::static_thread_pool::task_base {
+    explicit counting_task(std::atomic<int>& counter) noexcept
+      : counter_(counter) {
+      this->__execute = [](task_base* t, std::uint32_t tid) noexcept {
+        auto& self = *static_cast<counting_task*>(t);
+        self.tid_ = tid;
+        self.counter_.fetch_add(1, std::memory_order_release);
+      };
+    }
+
+    std::atomic<int>& counter_;
+    std::uint32_t tid_{std::numeric_limits<std::uint32_t>::max()};
+  };
+} // namespace
+
+TEST_CASE("static_thread_pool runs batches of tasks", "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{4};
+  std::atomic<int> counter{0};
+  std::vector<counting_task> tasks;
+  constexpr int num_tasks = 2000;
+  tasks.reserve(num_tasks);
+  for (int round = 0; round < 3; ++round) {
+    counter = 0;
+    tasks.clear();
+    stdexec::__intrusive_queue<&exec::static_thread_pool::task_base::next> queue;
+    for (int i = 0; i < num_tasks; ++i) {
+      queue.push_back(&tasks.emplace_back(counter));
+    }
+    pool.enqueue_batch(std::move(queue), num_tasks);
+    while (counter.load(std::memory_order_acquire) != num_tasks) {
+      std::this_thread::yield();
+    }
+    CHECK(std::ranges::all_of(tasks, [](const counting_task& t) { return t.tid_ < 4; }));
+  }
+  // Empty batches are fine.
+  pool.enqueue_batch({}, 0);
+}
+
+namespace {
+  //! Completes with the node of the `exec::node_allocator` in the environment of its receiver,
+  //! or with -2 if the environment has a different allocator or none at all.
+  struct allocator_node_sender {
+    using sender_concept = ex::sender_t;
+    using completion_signatures = ex::completion_signatures<ex::set_value_t(int)>;
+
+    template <class Receiver>
+    struct op {
+      using operation_state_concept = ex::operation_state_t;
+
+      void start() & noexcept {
+        ex::set_value(std::move(rcvr_), node());
+      }
+
+      [[nodiscard]]
+      auto node() const noexcept -> int {
+        if constexpr (requires { ex::get_allocator(ex::get_env(rcvr_)).node(); }) {
+          return ex::get_allocator(ex::get_env(rcvr_)).node();
+        } else {
+          return -2;
+        }
+      }
+
+      Receiver rcvr_;
+    };
+
+    template <class Receiver>
+    auto connect(Receiver rcvr) const -> op<Receiver> {
+      return {std::move(rcvr)};
+    }
+  };
+} // namespace
+
+TEST_CASE(
+  "static_thread_pool allocates on the NUMA node of its workers",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  CHECK(pool.get_allocator().node() < 0);
+  auto [worker_node] =
+    ex::sync_wait(ex::schedule(sched) | ex::then([&] { return pool.get_allocator().node(); }))
+      .value();
+  CHECK(worker_node >= 0);
+
+  SECTION("bulk provides the allocator to its predecessor") {
+    std::atomic<int> node{-3};
+    ex::sync_wait(ex::starts_on(
+      sched, allocator_node_sender{} | ex::bulk(ex::par, 4, [&](int, int n) { node = n; })));
+    CHECK(node >= 0);
+  }
+
+  SECTION("the allocator of the receiver takes precedence") {
+    std::atomic<int> node{-3};
+    ex::sync_wait(
+      ex::starts_on(
+        sched, allocator_node_sender{} | ex::bulk(ex::par, 4, [&](int, int n) { node = n; }))
+      | ex::write_env(ex::prop{ex::get_allocator, std::allocator<int>{}}));
+    CHECK(node == -2);
+  }
+
+  SECTION("schedule_all provides the allocator of its node to its items") {
+    std::atomic<int> counter{0};
+    std::atomic<bool> other_node{false};
+    ex::sync_wait(ex::starts_on(
+      sched,
+      exec::schedule_all(pool, std::views::iota(0, 100))
+        | exec::transform_each(
+          ex::let_value([](int) { return allocator_node_sender{}; }) | ex::then([&](int n) {
+            other_node = other_node || n != worker_node;
+            ++counter;
+          }))
+        | exec::ignore_all_values()));
+    CHECK(counter == 100);
+    CHECK_FALSE(other_node);
+  }
+
+  SECTION("schedule_all allocates its items from the allocator of the receiver") {
+    allocation_counts counts;
+    std::atomic<int> counter{0};
+    ex::sync_wait(
+      exec::schedule_all(pool, std::views::iota(0, 100))
+      | exec::transform_each(ex::then([&](int) { ++counter; })) | exec::ignore_all_values()
+      | ex::write_env(ex::prop{ex::get_allocator, counting_allocator<int>{counts}}));
+    CHECK(counter == 100);
+    CHECK(counts.allocations >= 1);
+    CHECK(counts.alive == 0);
+  }
+}
+
+#if defined(__linux__)
+TEST_CASE("static_thread_pool pins its workers to CPUs", "[types][static_thread_pool]") {
+  const exec::affinity_params affinity{.placement = exec::cpu_placement::compact};
+  const auto cpus = exec::cpu_topology::current().place(affinity);
+  exec::static_thread_pool pool{2, {.affinity = affinity}};
+  CHECK(pool.affinity().placement == exec::cpu_placement::compact);
+  for (std::size_t i = 0; i < 2 && !cpus.empty(); ++i) {
+    auto on_worker = ex::schedule(pool.get_scheduler_on_thread(i));
+    auto [cpu] = ex::sync_wait(on_worker | ex::then([] { return ::sched_getcpu(); })).value();
+    CHECK(cpu == cpus[i % cpus.size()].cpu);
+  }
+}
+#endif
+
+TEST_CASE("static_thread_pool bounds remote submissions", "[types][static_thread_pool]") {
+  const auto policy = GENERATE(exec::overflow_policy::wait, exec::overflow_policy::stop);
+  exec::static_thread_pool pool{1, {.backpressure = {.capacity = 2, .onFull = policy}}};
+  auto sched = pool.get_scheduler();
+
+  // Keep the only worker busy until `release` is set.
+  std::atomic<bool> started{false};
+  std::atomic<bool> release{false};
+  exec::async_scope scope;
+  scope.spawn(ex::schedule(sched) | ex::then([&] {
+                started = true;
+                while (!release) {
+                  std::this_thread::yield();
+                }
+              }));
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  constexpr int num_tasks = 10;
+  std::atomic<int> values{0};
+  std::atomic<int> stops{0};
+  for (int i = 0; i < num_tasks; ++i) {
+    scope.spawn(
+      ex::schedule(sched) | ex::then([&] { ++values; }) | ex::upon_stopped([&] { ++stops; }));
+  }
+  if (policy == exec::overflow_policy::stop) {
+    CHECK(stops == num_tasks - 2);
+  } else {
+    CHECK(stops == 0);
+  }
+  CHECK(values == 0);
+
+  release = true;
+  ex::sync_wait(scope.on_empty());
+  CHECK(values + stops == num_tasks);
+  CHECK(values == (policy == exec::overflow_policy::stop ? 2 : num_tasks));
+}
+
+TEST_CASE("static_thread_pool admits every waiting submission", "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{2, {.backpressure = {.capacity = 3}}};
+  auto sched = pool.get_scheduler();
+  constexpr int num_producers = 4;
+  constexpr int num_tasks = 500;
+  std::atomic<int> counter{0};
+  exec::async_scope scope;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < num_producers; ++p) {
+    producers.emplace_back([&] {
+      for (int i = 0; i < num_tasks; ++i) {
+        scope.spawn(ex::schedule(sched) | ex::then([&] { ++counter; }));
+      }
+    });
+  }
+  for (auto& producer: producers) {
+    producer.join();
+  }
+  ex::sync_wait(scope.on_empty());
+  CHECK(counter == num_producers * num_tasks);
+}
+
+TEST_CASE(
+  "static_thread_pool stops submissions that wait for a slot",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{1, {.backpressure = {.capacity = 1}}};
+  auto sched = pool.get_scheduler();
+
+  // Keep the only worker busy until `release` is set.
+  std::atomic<bool> started{false};
+  std::atomic<bool> release{false};
+  exec::async_scope busy;
+  busy.spawn(ex::schedule(sched) | ex::then([&] {
+               started = true;
+               while (!release) {
+                 std::this_thread::yield();
+               }
+             }));
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  // The first submission takes the only slot, the others wait for it.
+  constexpr int num_tasks = 5;
+  std::atomic<int> values{0};
+  std::atomic<int> stops{0};
+  exec::async_scope scope;
+  for (int i = 0; i < num_tasks; ++i) {
+    scope.spawn(
+      ex::schedule(sched) | ex::then([&] { ++values; }) | ex::upon_stopped([&] { ++stops; }));
+  }
+  scope.request_stop();
+  CHECK(stops == num_tasks - 1);
+  CHECK(values == 0);
+
+  release = true;
+  ex::sync_wait(busy.on_empty());
+  ex::sync_wait(scope.on_empty());
+  CHECK(stops == num_tasks);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This test is built as a separate executable with STDEXEC_STATIC_THREAD_POOL_STATISTICS=1.
+#include <catch2/catch.hpp>
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  auto total(const std::vector<exec::thread_pool_worker_stats>& stats)
+    -> exec::thread_pool_worker_stats {
+    exec::thread_pool_worker_stats sum{};
+    for (const auto& s: stats) {
+      sum.tasksExecuted += s.tasksExecuted;
+      sum.localPops += s.localPops;
+      sum.remotePops += s.remotePops;
+      sum.nearStealAttempts += s.nearStealAttempts;
+      sum.nearSteals += s.nearSteals;
+      sum.anyStealAttempts += s.anyStealAttempts;
+      sum.anySteals += s.anySteals;
+      sum.sleeps += s.sleeps;
+      sum.wakeups += s.wakeups;
+      sum.pendingOverflows += s.pendingOverflows;
+    }
+    return sum;
+  }
+} // namespace
+
+TEST_CASE("static_thread_pool counts the tasks of its workers", "[static_thread_pool][stats]") {
+  exec::static_thread_pool pool{4, exec::bwos_params{.numBlocks = 2, .blockSize = 2}};
+  auto sched = pool.get_scheduler();
+  REQUIRE(pool.stats().size() == 4);
+
+  constexpr int num_tasks = 200;
+  std::atomic<int> counter{0};
+  exec::async_scope scope;
+  // Tasks scheduled from a worker are pushed to its own, tiny, BWOS queue.
+  ex::sync_wait(ex::schedule(sched) | ex::then([&] {
+                  for (int i = 0; i < num_tasks; ++i) {
+                    scope.spawn(ex::schedule(sched) | ex::then([&] { ++counter; }));
+                  }
+                }));
+  ex::sync_wait(scope.on_empty());
+  REQUIRE(counter == num_tasks);
+
+  const auto stats = total(pool.stats());
+  CHECK(stats.tasksExecuted >= num_tasks + 1);
+  CHECK(
+    stats.tasksExecuted == stats.localPops + stats.remotePops + stats.nearSteals + stats.anySteals);
+  CHECK(stats.pendingOverflows > 0);
+  CHECK(stats.nearSteals <= stats.nearStealAttempts);
+  CHECK(stats.anySteals <= stats.anyStealAttempts);
+}
+
+TEST_CASE("static_thread_pool counts sleeps and wakeups", "[static_thread_pool][stats]") {
+  exec::static_thread_pool pool{2, {.spin = {.maxSpins = 0}}};
+  auto sched = pool.get_scheduler();
+
+  auto sleeping_workers = [&] {
+    std::uint32_t n = 0;
+    for (const auto& s: pool.stats()) {
+      n += s.sleeps > s.wakeups ? 1 : 0;
+    }
+    return n;
+  };
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (sleeping_workers() == 0 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  REQUIRE(total(pool.stats()).sleeps > 0);
+
+  for (int i = 0; i < 10; ++i) {
+    ex::sync_wait(ex::schedule(sched));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const auto stats = total(pool.stats());
+  CHECK(stats.wakeups > 0);
+  CHECK(stats.wakeups <= stats.sleeps);
+  CHECK(stats.tasksExecuted >= 10);
+}
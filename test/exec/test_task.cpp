@@ -22,10 +22,13 @@
 #  include <exec/single_thread_context.hpp>
 #  include <exec/async_scope.hpp>
 
+#  include <test_common/allocators.hpp>
 #  include <test_common/schedulers.hpp>
 
 #  include <catch2/catch.hpp>
 
+#  include <cstddef>
+#  include <memory>
 #  include <string>
 
 using namespace exec;
@@ -304,6 +307,108 @@ namespace {
     CHECK(msg == "goodbye"s);
   }
 
+  auto add_one(std::allocator_arg_t, counting_allocator<std::byte>, int i) -> exec::task<int> {
+    co_return i + 1;
+  }
+
+  struct adder {
+    auto add(std::allocator_arg_t, counting_allocator<std::byte>, int i) const
+      -> exec::task<int> {
+      co_return i + n;
+    }
+
+    int n;
+  };
+
+  TEST_CASE("task - frame is allocated with an allocator_arg allocator", "[types][task]") {
+    allocation_counts counts;
+    counting_allocator<std::byte> alloc{counts};
+    {
+      auto [i] = stdexec::sync_wait(add_one(std::allocator_arg, alloc, 41)).value();
+      CHECK(i == 42);
+      CHECK(counts.allocations == 1);
+      CHECK(counts.alive == 0);
+    }
+    {
+      adder a{2};
+      auto [i] = stdexec::sync_wait(a.add(std::allocator_arg, alloc, 40)).value();
+      CHECK(i == 42);
+      CHECK(counts.allocations == 2);
+      CHECK(counts.alive == 0);
+    }
+  }
+
+  TEST_CASE("task - frames are recycled by the thread", "[types][task]") {
+    auto make = [](int i) -> exec::task<int> {
+      co_return i;
+    };
+    void* first = nullptr;
+    {
+      auto t = make(1);
+      first = t.__coro_.address();
+    }
+    auto t = make(2);
+    CHECK(t.__coro_.address() == first);
+    auto [i] = stdexec::sync_wait(std::move(t)).value();
+    CHECK(i == 2);
+  }
+
+  // Completes inline and counts how often it is scheduled on.
+  struct counting_scheduler {
+    struct sender {
+      using sender_concept = stdexec::sender_t;
+      using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t()>;
+
+      template <class R>
+      auto connect(R rcvr) const noexcept {
+        ++*count_;
+        return stdexec::connect(stdexec::just(), static_cast<R&&>(rcvr));
+      }
+
+      [[nodiscard]]
+      auto get_env() const noexcept {
+        return prop{get_completion_scheduler<set_value_t>, counting_scheduler{count_}};
+      }
+
+      int* count_;
+    };
+
+    [[nodiscard]]
+    auto schedule() const noexcept -> sender {
+      return {count_};
+    }
+
+    auto operator==(const counting_scheduler&) const noexcept -> bool = default;
+
+    int* count_;
+  };
+
+  TEST_CASE("task - does not reschedule when already on its scheduler", "[types][task]") {
+    int count = 0;
+    counting_scheduler sched{&count};
+    auto child = []() -> exec::task<int> {
+      co_return 42;
+    };
+    auto parent = [&]() -> exec::task<int> {
+      const int started = count;
+      // Completes on the scheduler of the task:
+      co_await stdexec::schedule(sched);
+      CHECK(count == started + 1);
+      // Completes on the calling thread:
+      co_await stdexec::just();
+      CHECK(count == started + 1);
+      // Nested tasks resume their parent on its scheduler:
+      int i = co_await child();
+      CHECK(count == started + 1);
+      // The completion scheduler is not known to be the one of the task:
+      co_await stdexec::schedule(basic_inline_scheduler<>{});
+      CHECK(count == started + 2);
+      co_return i;
+    };
+    auto [i] = stdexec::sync_wait(stdexec::starts_on(sched, parent())).value();
+    CHECK(i == 42);
+  }
+
 #  if !STDEXEC_STD_NO_EXCEPTIONS()
   TEST_CASE("task - can error early", "[types][task]") {
     int count = 0;
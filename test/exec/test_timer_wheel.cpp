@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "exec/__detail/__timer_wheel.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+  struct node {
+    std::uint64_t tick{};
+    node* next{};
+    node** pprev{};
+    std::uint64_t expired_at{0};
+  };
+
+  using wheel_t = exec::timer_wheel<&node::tick, &node::next, &node::pprev>;
+
+  auto expire_into(std::vector<node*>& expired, const wheel_t& wheel) {
+    return [&](node* n) {
+      n->expired_at = wheel.now();
+      expired.push_back(n);
+    };
+  }
+} // namespace
+
+TEST_CASE("exec::timer_wheel - basic operations", "[timer_wheel]") {
+  wheel_t wheel{};
+  std::vector<node*> expired;
+  node a{.tick = 5};
+  node b{.tick = 70};
+
+  SECTION("Empty") {
+    CHECK(wheel.empty());
+    CHECK(wheel.next_tick() == wheel_t::never);
+    wheel.advance(100, expire_into(expired, wheel));
+    CHECK(wheel.now() == 100);
+    CHECK(expired.empty());
+  }
+  SECTION("Expired nodes are not inserted") {
+    wheel.advance(10, expire_into(expired, wheel));
+    CHECK_FALSE(wheel.insert(&a));
+    CHECK(wheel.empty());
+  }
+  SECTION("Expire in order") {
+    CHECK(wheel.insert(&b));
+    CHECK(wheel.insert(&a));
+    CHECK(wheel.size() == 2);
+    CHECK(wheel.next_tick() == 5);
+    wheel.advance(4, expire_into(expired, wheel));
+    CHECK(expired.empty());
+    wheel.advance(69, expire_into(expired, wheel));
+    REQUIRE(expired.size() == 1);
+    CHECK(expired[0] == &a);
+    CHECK(a.expired_at == 5);
+    wheel.advance(1000, expire_into(expired, wheel));
+    REQUIRE(expired.size() == 2);
+    CHECK(expired[1] == &b);
+    CHECK(b.expired_at == 70);
+    CHECK(wheel.empty());
+  }
+  SECTION("Erase") {
+    CHECK(wheel.insert(&a));
+    CHECK(wheel.insert(&b));
+    wheel.erase(&a);
+    CHECK(wheel.size() == 1);
+    wheel.advance(1000, expire_into(expired, wheel));
+    REQUIRE(expired.size() == 1);
+    CHECK(expired[0] == &b);
+  }
+}
+
+TEST_CASE("exec::timer_wheel - nodes expire exactly at their tick", "[timer_wheel]") {
+  wheel_t wheel{3};
+  std::vector<node> nodes(2000);
+  std::mt19937_64 rng{42};
+  // Spans all levels as well as the overflow list.
+  for (auto& n: nodes) {
+    n.tick = 4 + rng() % (std::uint64_t(1) << (rng() % 27));
+  }
+  nodes[0].tick = std::uint64_t(1) << 30;
+  for (auto& n: nodes) {
+    REQUIRE(wheel.insert(&n));
+  }
+  for (std::size_t i = 0; i < nodes.size(); i += 3) {
+    wheel.erase(&nodes[i]);
+  }
+  std::vector<node*> expired;
+  std::uint64_t now = 3;
+  while (!wheel.empty()) {
+    now += rng() % 100'000;
+    wheel.advance(now, expire_into(expired, wheel));
+  }
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    if (i % 3 == 0) {
+      CHECK(nodes[i].expired_at == 0);
+    } else {
+      CHECK(nodes[i].expired_at == nodes[i].tick);
+    }
+  }
+  CHECK(expired.size() == nodes.size() - (nodes.size() + 2) / 3);
+
+  // Advancing tick by tick never expires late.
+  wheel_t fine{0};
+  for (std::size_t i = 1; i < 300; ++i) {
+    nodes[i].tick = i * 37;
+    REQUIRE(fine.insert(&nodes[i]));
+  }
+  for (std::uint64_t tick = 1; !fine.empty(); ++tick) {
+    fine.advance(tick, expire_into(expired, fine));
+  }
+  for (std::size_t i = 1; i < 300; ++i) {
+    CHECK(nodes[i].expired_at == nodes[i].tick);
+  }
+}
@@ -22,6 +22,7 @@
 #include <test_common/schedulers.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/type_helpers.hpp>
+#include <test_common/allocators.hpp>
 
 namespace ex = stdexec;
 using exec::async_scope;
@@ -335,4 +336,23 @@ namespace {
     (void) snd1;
     (void) snd2;
   }
+
+  TEST_CASE(
+    "ensure_started allocates its shared state with the allocator of the env",
+    "[adaptors][ensure_started]") {
+    impulse_scheduler sch;
+    allocation_counts counts;
+    {
+      auto snd = ex::ensure_started(
+        ex::starts_on(sch, ex::just(42)),
+        ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+      CHECK(counts.allocations == 1);
+      CHECK(counts.alive == 1);
+      sch.start_next();
+      auto [val] = ex::sync_wait(std::move(snd)).value();
+      CHECK(val == 42);
+    }
+    CHECK(counts.allocations == 1);
+    CHECK(counts.alive == 0);
+  }
 } // namespace
@@ -21,6 +21,7 @@
 #include <test_common/senders.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/type_helpers.hpp>
+#include <test_common/allocators.hpp>
 #include <exec/static_thread_pool.hpp>
 
 namespace ex = stdexec;
@@ -512,4 +513,94 @@ namespace {
     (void) snd1;
     (void) snd2;
   }
+
+  TEST_CASE("split allocates its shared state with the allocator of the env", "[adaptors][split]") {
+    allocation_counts counts;
+    {
+      auto split = ex::split(
+        ex::just(42), ex::prop{ex::get_allocator, counting_allocator<std::byte>{counts}});
+      CHECK(counts.allocations == 1);
+      auto [v1] = ex::sync_wait(split).value();
+      auto [v2] = ex::sync_wait(split).value();
+      CHECK(v1 == 42);
+      CHECK(v2 == 42);
+      CHECK(counts.alive == 1);
+    }
+    CHECK(counts.allocations == 1);
+    CHECK(counts.alive == 0);
+  }
+
+  struct counting_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value(int) noexcept {
+      ++*values_;
+    }
+
+    void set_stopped() noexcept {
+      ++*stops_;
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+      FAIL_CHECK("set_error called on counting_receiver");
+    }
+
+    [[nodiscard]]
+    auto get_env() const noexcept {
+      return ex::prop{ex::get_stop_token, token_};
+    }
+
+    std::atomic<int>* values_;
+    std::atomic<int>* stops_;
+    ex::inplace_stop_token token_;
+  };
+
+  TEST_CASE("split completes every concurrent subscriber exactly once", "[adaptors][split]") {
+    exec::static_thread_pool pool{2};
+    constexpr int num_threads = 8;
+    constexpr int subscribers_per_thread = 50;
+
+    for (int round = 0; round < 10; ++round) {
+      std::atomic<bool> go{false};
+      auto split = ex::schedule(pool.get_scheduler()) | ex::then([&] {
+                     while (!go.load()) {
+                       std::this_thread::yield();
+                     }
+                     return 42;
+                   })
+                 | ex::split();
+      using op_t = ex::connect_result_t<decltype(split)&, counting_receiver>;
+
+      std::atomic<int> values{0};
+      std::atomic<int> stops{0};
+      std::vector<std::thread> threads;
+      for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+          std::vector<ex::inplace_stop_source> sources(subscribers_per_thread);
+          std::vector<std::optional<op_t>> ops(subscribers_per_thread);
+          for (int i = 0; i < subscribers_per_thread; ++i) {
+            ops[i].emplace(ex::__emplace_from{[&] {
+              return ex::connect(split, counting_receiver{&values, &stops, sources[i].get_token()});
+            }});
+            ex::start(*ops[i]);
+            // Every third subscriber gives up, some of them after the work completed.
+            if ((i + t) % 3 == 0) {
+              sources[i].request_stop();
+            }
+            if (t == 0 && i == subscribers_per_thread / 2) {
+              go = true;
+            }
+          }
+          while (values.load() + stops.load() < num_threads * subscribers_per_thread) {
+            std::this_thread::yield();
+          }
+        });
+      }
+      for (auto& thread: threads) {
+        thread.join();
+      }
+      CHECK(values.load() + stops.load() == num_threads * subscribers_per_thread);
+      CHECK(values.load() >= num_threads * subscribers_per_thread * 2 / 3);
+    }
+  }
 } // namespace